@@ -66,6 +66,89 @@ int main()
             std::vector<double>(standard4.getSmallestNumberOfStates(), 1e-5), __FILE__, __LINE__,
             "DoublePendulum3D_FrameKeyword failed");
         cout << "DoublePendulum3D_FrameKeyword passed" << endl;
+
+        // Running in parallel over frames must give the same results as
+        // running serially.
+        {
+            AnalyzeTool analyze5("SinglePin_Setup_JointReaction.xml");
+            analyze5.setName("SinglePin_parallel");
+            analyze5.setNumThreads(3);
+            analyze5.setParallelMode(AnalyzeTool::ParallelOverFrames);
+            analyze5.run();
+            Storage result5("SinglePin_parallel_JointReaction_ReactionLoads.sto");
+            CHECK_STORAGE_AGAINST_STANDARD(result5, standard1,
+                std::vector<double>(standard1.getSmallestNumberOfStates(), 1e-5), __FILE__, __LINE__,
+                "SinglePin parallel over frames failed");
+            ASSERT(result5.getSize() == result1.getSize());
+        }
+        cout << "SinglePin parallel over frames passed" << endl;
+
+        // Running the analyses on separate threads must give the same
+        // results as running them serially. The setup gets two more analyses
+        // so that each of the three threads runs one.
+        auto runThreeAnalyses = [](const std::string& name, int numThreads) {
+            AnalyzeTool analyze6("SinglePin_Setup_JointReaction.xml");
+            analyze6.setName(name);
+            JointReaction* onParent = new JointReaction();
+            onParent->setName("JointReactionOnParent");
+            Array<std::string> joints("pin1", 1);
+            Array<std::string> parent("parent", 1);
+            Array<std::string> ground("ground", 1);
+            onParent->setJointNames(joints);
+            onParent->setOnBody(parent);
+            onParent->setInFrame(ground);
+            analyze6.getAnalysisSet().adoptAndAppend(onParent);
+            BodyKinematics* kinematics = new BodyKinematics();
+            kinematics->setName("BodyKinematics");
+            analyze6.getAnalysisSet().adoptAndAppend(kinematics);
+            analyze6.setNumThreads(numThreads);
+            analyze6.setParallelMode(AnalyzeTool::ParallelOverAnalyses);
+            analyze6.run();
+        };
+        runThreeAnalyses("SinglePin_serial", 1);
+        runThreeAnalyses("SinglePin_analyses", 3);
+        for (const std::string& results : {"JointReaction_ReactionLoads",
+                "JointReactionOnParent_ReactionLoads",
+                "BodyKinematics_pos_global", "BodyKinematics_vel_global",
+                "BodyKinematics_acc_global"}) {
+            Storage serial("SinglePin_serial_" + results + ".sto"),
+                parallel("SinglePin_analyses_" + results + ".sto");
+            ASSERT(parallel.getSize() == serial.getSize());
+            CHECK_STORAGE_AGAINST_STANDARD(parallel, serial,
+                std::vector<double>(serial.getSmallestNumberOfStates(), 1e-8), __FILE__, __LINE__,
+                "SinglePin parallel over analyses failed for " + results);
+        }
+        cout << "SinglePin parallel over analyses passed" << endl;
+
+        // Reactions on the parent must be the opposite of the reactions on
+        // the child, acting at the joint's parent frame.
+        Model model("DoublePendulum3D.osim");
+        JointReaction* reactions = new JointReaction(&model);
+        reactions->setName("JointReaction");
+        Array<std::string> onParent("parent", 1);
+        Array<std::string> inGround("ground", 1);
+        reactions->setOnBody(onParent);
+        reactions->setInFrame(inGround);
+        model.addAnalysis(reactions);
+        SimTK::State& s = model.initSystem();
+        reactions->setModel(model);
+        for (int i = 0; i < s.getNQ(); ++i) s.updQ()[i] = 0.1 * (i + 1);
+        for (int i = 0; i < s.getNU(); ++i) s.updU()[i] = -0.2 * (i + 1);
+        model.realizeAcceleration(s);
+        reactions->begin(s);
+        const Storage& loads = *reactions->getStorageList()[0];
+        const Array<double>& row = loads.getStateVector(0)->getData();
+        const JointSet& joints = model.getJointSet();
+        ASSERT(row.getSize() == 9 * joints.getSize());
+        for (int j = 0; j < joints.getSize(); ++j) {
+            const SimTK::SpatialVec expected =
+                joints[j].calcReactionOnParentExpressedInGround(s);
+            for (int k = 0; k < 3; ++k) {
+                ASSERT_EQUAL(expected[1][k], row[9*j + k], 1e-8);
+                ASSERT_EQUAL(expected[0][k], row[9*j + 3 + k], 1e-8);
+            }
+        }
+        cout << "DoublePendulum3D reactions on parent passed" << endl;
     }
     catch (const std::exception& e) {
         cout << e.what() << endl;
@@ -24,6 +24,10 @@
 #include <OpenSim/Simulation/Model/Model.h>
 #include <OpenSim/Simulation/Model/AnalysisSet.h>
 #include <OpenSim/Tools/CMCTool.h>
+#include <OpenSim/Tools/CMC.h>
+#include <OpenSim/Tools/CMC_Joint.h>
+#include <OpenSim/Tools/CMC_Point.h>
+#include <OpenSim/Tools/CMC_TaskSet.h>
 #include <OpenSim/Tools/ForwardTool.h>
 #include <OpenSim/Auxiliary/auxiliaryTestFunctions.h>
 
@@ -53,11 +57,93 @@ void testCMCArm26() {
     cout << "\n" << base <<" passed\n" << endl;
 }
 
+// A joint task that does not provide its acceleration sensitivity, so that
+// CMC has to find the actuator acceleration map by perturbation.
+class OpaqueJointTask : public CMC_Joint {
+OpenSim_DECLARE_CONCRETE_OBJECT(OpaqueJointTask, CMC_Joint);
+public:
+    OpaqueJointTask(const CMC_Joint& task) : CMC_Joint(task) {}
+    bool computeAccelerationSensitivity(const SimTK::State&,
+            const SimTK::Vector&, SimTK::Vec3&) const override {
+        return false;
+    }
+};
+
+void testActuatorAccelerationMap() {
+    Model model("arm26.osim");
+    CMC_TaskSet taskSet("arm26_ComputedMuscleControl_Tasks.xml");
+    CMC_Point* hand = new CMC_Point(SimTK::Vec3(0, -0.3, 0));
+    hand->setName("hand");
+    hand->setWRTBodyName("r_ulna_radius_hand");
+    hand->setActive(true, true, false);
+    taskSet.adoptAndAppend(hand);
+
+    CMC* controller = new CMC(&model, &taskSet);
+    controller->setActuators(model.updActuators());
+    model.addController(controller);
+    SimTK::State& s = model.initSystem();
+    taskSet.setModel(model);
+    model.getCoordinateSet().get("r_elbow_flex").setValue(s, 0.8);
+    model.getCoordinateSet().get("r_elbow_flex").setSpeedValue(s, -1.2);
+
+    SimTK::Vector a0, unitStress;
+    SimTK::Matrix dadf;
+    controller->computeActuatorAccelerationMap(s, a0, dadf, unitStress);
+    const Set<const Actuator>& actuators = controller->getActuatorSet();
+    const int na = actuators.getSize();
+    const int nacc = a0.size();
+    ASSERT(nacc == 4 && dadf.nrow() == nacc && dadf.ncol() == na);
+
+    // Compare with realizing the model with a unit force for each actuator.
+    for(int j=0; j<na; j++) {
+        SimTK::State sj = s;
+        for(int k=0; k<na; k++) {
+            auto& act = dynamic_cast<const ScalarActuator&>(actuators[k]);
+            act.overrideActuation(sj, true);
+            act.setOverrideActuation(sj, k == j ? 1.0 : 0.0);
+        }
+        model.realizeAcceleration(sj);
+        taskSet.computeAccelerations(sj);
+        const Array<double>& a = taskSet.getAccelerations();
+        for(int i=0; i<nacc; i++)
+            ASSERT_EQUAL(a[i], a0[i] + dadf(i,j),
+                         1e-8*(1 + std::abs(a[i])), __FILE__, __LINE__,
+                         "Actuator acceleration map is inaccurate.");
+        ASSERT_EQUAL(dynamic_cast<const ScalarActuator&>(actuators[j])
+                     .getStress(sj), unitStress[j], 1e-12);
+    }
+
+    // A task without an acceleration sensitivity requires perturbations.
+    OpaqueJointTask* opaque = new OpaqueJointTask(
+            dynamic_cast<const CMC_Joint&>(taskSet.get(0)));
+    opaque->setName("opaque");
+    taskSet.adoptAndAppend(opaque);
+    taskSet.setModel(model);
+    SimTK::Vector a0Perturbed, unitStressPerturbed;
+    SimTK::Matrix dadfPerturbed;
+    controller->computeActuatorAccelerationMap(s, a0Perturbed,
+            dadfPerturbed, unitStressPerturbed);
+    ASSERT(a0Perturbed.size() == nacc + 1);
+    for(int j=0; j<na; j++) {
+        for(int i=0; i<nacc; i++)
+            ASSERT_EQUAL(dadf(i,j), dadfPerturbed(i,j),
+                         1e-8*(1 + std::abs(dadf(i,j))));
+        ASSERT_EQUAL(dadf(0,j), dadfPerturbed(nacc,j),
+                     1e-8*(1 + std::abs(dadf(0,j))));
+        ASSERT_EQUAL(unitStress[j], unitStressPerturbed[j], 1e-12);
+    }
+}
 
 int main() {
 
     SimTK::Array_<std::string> failures;
 
+    try{
+        testActuatorAccelerationMap();
+    } catch(const std::exception& e) {
+        cout << e.what() <<endl; failures.push_back("testActuatorAccelerationMap");
+    }
+
     try{
         testCMCArm26();
     } catch(const std::exception& e) {  
@@ -51,6 +51,7 @@ using namespace OpenSim;
 using std::cout; using std::endl;
 
 void scaleGait2354();
+void scaleGait2354Batch();
 void scaleGait2354_GUI(bool useMarkerPlacement);
 void scaleModelWithLigament();
 bool compareStdScaleToComputed(const ScaleSet& std, const ScaleSet& comp);
@@ -65,6 +66,7 @@ int main()
 {
     try {
         scaleGait2354();
+        scaleGait2354Batch();
         scaleGait2354_GUI(false);
         scaleModelWithLigament();
         scalePhysicalOffsetFrames();
@@ -206,6 +208,28 @@ void scaleGait2354()
                            "std_subject01_simbody.osim", 1.0e-6);
 }
 
+void scaleGait2354Batch()
+{
+    // Scale several copies of the same subject concurrently from one
+    // generic model held in memory; each must match the serial result.
+    ScaleTool subject("subject01_Setup_Scale.xml");
+    std::unique_ptr<Model> genericModel(subject.createModel());
+
+    const int numSubjects = 3;
+    std::vector<ScaleTool> subjects(numSubjects, subject);
+    auto models = ScaleTool::runBatch(*genericModel, subjects, 2);
+    ASSERT((int)models.size() == numSubjects);
+
+    for (int i = 0; i < numSubjects; ++i) {
+        ASSERT(models[i] != nullptr);
+        const std::string resultFilename =
+                "subject01_batch" + std::to_string(i) + "_simbody.osim";
+        models[i]->print(resultFilename);
+        compareModelToStandard(resultFilename,
+                               "std_subject01_simbody.osim", 1.0e-6);
+    }
+}
+
 void scaleGait2354_GUI(bool useMarkerPlacement)
 {
     // SET OUTPUT FORMATTING
@@ -55,6 +55,7 @@
 #include <OpenSim/Common/STOFileAdapter.h>
 #include <OpenSim/Common/CSVFileAdapter.h>
 #include <OpenSim/Common/C3DFileAdapter.h>
+#include <OpenSim/Common/NativeC3DFileAdapter.h>
 #include <OpenSim/Common/IMUDataReader.h>
 #include <OpenSim/Common/XsensDataReader.h>
 #include <OpenSim/Common/APDMDataReaderSettings.h>
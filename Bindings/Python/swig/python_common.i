@@ -288,6 +288,91 @@ note: ## is a "glue" operator: `a ## b` --> `ab`.
     }
 }
 
+// NumPy interoperability
+// ======================
+// np.asarray(table) is a view of the dependent columns of the table (see
+// python_simbody.i); the array refers to the table, which keeps it alive.
+// The matrix, column and row views that a table returns refer to the table
+// too, so np.asarray(table.getMatrix()) also keeps the table alive, even if
+// it is a temporary. createFromNumPy() builds a table from NumPy arrays with
+// one copy of the data.
+%define KEEP_TABLE_ALIVE(METHOD)
+%pythonappend OpenSim::DataTable_::METHOD %{
+    val._owner = self
+%}
+%enddef
+KEEP_TABLE_ALIVE(getMatrix);
+KEEP_TABLE_ALIVE(updMatrix);
+KEEP_TABLE_ALIVE(getMatrixBlock);
+KEEP_TABLE_ALIVE(updMatrixBlock);
+KEEP_TABLE_ALIVE(getDependentColumn);
+KEEP_TABLE_ALIVE(getDependentColumnAtIndex);
+KEEP_TABLE_ALIVE(updDependentColumn);
+KEEP_TABLE_ALIVE(updDependentColumnAtIndex);
+KEEP_TABLE_ALIVE(getRow);
+KEEP_TABLE_ALIVE(getRowAtIndex);
+KEEP_TABLE_ALIVE(updRow);
+KEEP_TABLE_ALIVE(updRowAtIndex);
+
+%extend OpenSim::TimeSeriesTable_<double> {
+    static OpenSim::TimeSeriesTable_<double> _createFromBuffers(
+            PyObject* times, PyObject* data,
+            const std::vector<std::string>& labels) {
+        const Float64Buffer t(times, 1);
+        const Float64Buffer d(data, 2);
+        return OpenSim::TimeSeriesTable_<double>(
+                std::vector<double>(t.data(), t.data() + t.shape(0)),
+                SimTK::Matrix(d.shape(0), d.shape(1), d.data()),
+                labels);
+    }
+%pythoncode %{
+    @staticmethod
+    def createFromNumPy(times, data, labels):
+        """Create a TimeSeriesTable with a copy of the 1-dimensional array
+        `times` and the 2-dimensional array `data` (one row per time), with
+        the given column labels."""
+        import numpy as np
+        return TimeSeriesTable._createFromBuffers(
+                np.ascontiguousarray(times, dtype=np.float64),
+                np.ascontiguousarray(data, dtype=np.float64), list(labels))
+
+    @property
+    def __array_interface__(self):
+        return self.getMatrix().__array_interface__
+%}
+}
+%extend OpenSim::TimeSeriesTable_<SimTK::Vec3> {
+    static OpenSim::TimeSeriesTable_<SimTK::Vec3> _createFromBuffers(
+            PyObject* times, PyObject* data,
+            const std::vector<std::string>& labels) {
+        const Float64Buffer t(times, 1);
+        const Float64Buffer d(data, 3);
+        if (d.shape(2) != 3)
+            throw std::invalid_argument("Expected data of shape "
+                    "(nrow, ncol, 3).");
+        return OpenSim::TimeSeriesTable_<SimTK::Vec3>(
+                std::vector<double>(t.data(), t.data() + t.shape(0)),
+                SimTK::Matrix_<SimTK::Vec3>(d.shape(0), d.shape(1),
+                        reinterpret_cast<const SimTK::Vec3*>(d.data())),
+                labels);
+    }
+%pythoncode %{
+    @staticmethod
+    def createFromNumPy(times, data, labels):
+        """Create a TimeSeriesTableVec3 with a copy of the 1-dimensional
+        array `times` and the array `data` of shape (nrow, ncol, 3), with the
+        given column labels."""
+        import numpy as np
+        return TimeSeriesTableVec3._createFromBuffers(
+                np.ascontiguousarray(times, dtype=np.float64),
+                np.ascontiguousarray(data, dtype=np.float64), list(labels))
+
+    @property
+    def __array_interface__(self):
+        return self.getMatrix().__array_interface__
+%}
+}
+
 // Include all the OpenSim code.
 // =============================
 %include <Bindings/preliminaries.i>
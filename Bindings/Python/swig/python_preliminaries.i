@@ -18,6 +18,46 @@ own project.
 %include "typemaps.i"
 %include "std_string.i"
 
+/* Read the data of Python objects that support the buffer protocol (e.g.,
+NumPy arrays) without converting element by element. */
+%{
+#include <stdexcept>
+#include <string>
+namespace {
+// A C-contiguous, read-only view of an `ndim`-dimensional array of float64.
+// Throws std::invalid_argument (a RuntimeError in Python) for other objects.
+class Float64Buffer {
+public:
+    Float64Buffer(PyObject* obj, int ndim) {
+        if (PyObject_GetBuffer(obj, &_view,
+                               PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) != 0) {
+            PyErr_Clear();
+            throw std::invalid_argument("Expected an object with C-contiguous "
+                    "data that supports the buffer protocol (e.g., a NumPy "
+                    "array).");
+        }
+        const std::string format = _view.format ? _view.format : "B";
+        if (_view.ndim != ndim || _view.itemsize != sizeof(double) ||
+                (format != "d" && format != "@d" && format != "=d")) {
+            PyBuffer_Release(&_view);
+            throw std::invalid_argument("Expected a " + std::to_string(ndim) +
+                    "-dimensional array of float64 but got a " +
+                    std::to_string(_view.ndim) + "-dimensional array of '" +
+                    format + "'.");
+        }
+    }
+    Float64Buffer(const Float64Buffer&) = delete;
+    Float64Buffer& operator=(const Float64Buffer&) = delete;
+    ~Float64Buffer() { PyBuffer_Release(&_view); }
+
+    const double* data() const { return static_cast<const double*>(_view.buf); }
+    int shape(int i) const { return static_cast<int>(_view.shape[i]); }
+private:
+    Py_buffer _view;
+};
+}
+%}
+
 /* If needed %extend will be used, these operators are not supported.*/
 %ignore *::operator[];
 %ignore *::operator=;
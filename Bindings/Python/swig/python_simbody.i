@@ -149,3 +149,162 @@ These typemaps work, though.
     }
 };
 
+// NumPy interoperability
+// ======================
+// Vectors, matrices and their views expose __array_interface__, so
+// np.asarray(m) is a view of the Simbody data rather than a copy. The array
+// keeps `m` alive; views returned by tables keep their table alive in turn
+// (see python_common.i). The array is invalidated if the data is resized.
+// Use np.array(m) to copy. createFromNumPy() copies the data of a NumPy
+// array (or any buffer of float64) in one pass.
+%template(StdVectorLongLong) std::vector<long long>;
+%{
+#include <cstdint>
+namespace {
+// Address of element (i, j) as an integer, for __array_interface__.
+template <class ELT>
+long long eltAddress(const SimTK::MatrixBase<ELT>& m, int i, int j) {
+    return static_cast<long long>(
+            reinterpret_cast<std::uintptr_t>(&m.getElt(i, j)));
+}
+// The address of the first element and the distances in bytes between
+// consecutive rows and columns. Throws if the elements are not evenly spaced
+// (only possible for views that select arbitrary rows or columns).
+template <class ELT>
+std::vector<long long> stridedLayout(const SimTK::MatrixBase<ELT>& m) {
+    const int nr = m.nrow(), nc = m.ncol();
+    const long long eltSize = sizeof(ELT);
+    if (nr == 0 || nc == 0) return {0, eltSize, eltSize};
+    const long long first = eltAddress(m, 0, 0);
+    const long long rowStride = nr > 1 ? eltAddress(m, 1, 0) - first
+                                       : eltSize;
+    const long long colStride = nc > 1 ? eltAddress(m, 0, 1) - first
+                                       : eltSize;
+    if (eltAddress(m, nr - 1, nc - 1) !=
+            first + (nr - 1) * rowStride + (nc - 1) * colStride)
+        throw std::invalid_argument("The elements of this matrix are not "
+                "evenly spaced in memory; copy it before converting it "
+                "to a NumPy array.");
+    return {first, rowStride, colStride};
+}
+}
+%}
+
+%pythoncode %{
+def _array_interface(layout, shape, trailing_shape=(), trailing_strides=()):
+    """__array_interface__ for a Simbody matrix with the given layout
+    (address, row stride, column stride)."""
+    import sys
+    address, row_stride, col_stride = layout
+    typestr = ('<' if sys.byteorder == 'little' else '>') + 'f8'
+    return {'version': 3, 'typestr': typestr,
+            'shape': shape + trailing_shape,
+            'strides': (row_stride, col_stride)[:len(shape)] +
+                       trailing_strides,
+            # The address of an empty matrix is 0.
+            'data': (address, False)}
+%}
+
+%extend SimTK::MatrixBase<double> {
+    std::vector<long long> _getLayout() const {
+        return stridedLayout(*$self);
+    }
+%pythoncode %{
+    @property
+    def __array_interface__(self):
+        return _array_interface(self._getLayout(), (self.nrow(), self.ncol()))
+%}
+};
+%extend SimTK::MatrixBase<SimTK::Vec3> {
+    std::vector<long long> _getLayout() const {
+        return stridedLayout(*$self);
+    }
+%pythoncode %{
+    @property
+    def __array_interface__(self):
+        return _array_interface(self._getLayout(), (self.nrow(), self.ncol()),
+                                (3,), (8,))
+%}
+};
+%extend SimTK::VectorBase<double> {
+    std::vector<long long> _getLayout() const {
+        return stridedLayout(*$self);
+    }
+%pythoncode %{
+    @property
+    def __array_interface__(self):
+        return _array_interface(self._getLayout(), (self.nrow(),))
+%}
+};
+%extend SimTK::VectorBase<SimTK::Vec3> {
+    std::vector<long long> _getLayout() const {
+        return stridedLayout(*$self);
+    }
+%pythoncode %{
+    @property
+    def __array_interface__(self):
+        return _array_interface(self._getLayout(), (self.nrow(),), (3,), (8,))
+%}
+};
+%extend SimTK::RowVectorBase<double> {
+    std::vector<long long> _getLayout() const {
+        const auto layout = stridedLayout(*$self);
+        // A row vector is indexed by its columns.
+        return {layout[0], layout[2], layout[1]};
+    }
+%pythoncode %{
+    @property
+    def __array_interface__(self):
+        return _array_interface(self._getLayout(), (self.ncol(),))
+%}
+};
+
+%extend SimTK::Vector_<double> {
+    static SimTK::Vector_<double> _createFromBuffer(PyObject* buffer) {
+        const Float64Buffer data(buffer, 1);
+        return SimTK::Vector_<double>(data.shape(0), data.data());
+    }
+%pythoncode %{
+    @staticmethod
+    def createFromNumPy(array):
+        """Create a Vector with a copy of a 1-dimensional NumPy array."""
+        import numpy as np
+        return Vector._createFromBuffer(
+                np.ascontiguousarray(array, dtype=np.float64))
+%}
+};
+%extend SimTK::Matrix_<double> {
+    static SimTK::Matrix_<double> _createFromBuffer(PyObject* buffer) {
+        const Float64Buffer data(buffer, 2);
+        return SimTK::Matrix_<double>(data.shape(0), data.shape(1),
+                                      data.data());
+    }
+%pythoncode %{
+    @staticmethod
+    def createFromNumPy(array):
+        """Create a Matrix with a copy of a 2-dimensional NumPy array."""
+        import numpy as np
+        return Matrix._createFromBuffer(
+                np.ascontiguousarray(array, dtype=np.float64))
+%}
+};
+%extend SimTK::Matrix_<SimTK::Vec3> {
+    static SimTK::Matrix_<SimTK::Vec3> _createFromBuffer(PyObject* buffer) {
+        const Float64Buffer data(buffer, 3);
+        if (data.shape(2) != 3)
+            throw std::invalid_argument("Expected an array of shape "
+                    "(nrow, ncol, 3).");
+        return SimTK::Matrix_<SimTK::Vec3>(data.shape(0), data.shape(1),
+                reinterpret_cast<const SimTK::Vec3*>(data.data()));
+    }
+%pythoncode %{
+    @staticmethod
+    def createFromNumPy(array):
+        """Create a MatrixVec3 with a copy of a NumPy array of shape
+        (nrow, ncol, 3)."""
+        import numpy as np
+        return MatrixVec3._createFromBuffer(
+                np.ascontiguousarray(array, dtype=np.float64))
+%}
+};
+
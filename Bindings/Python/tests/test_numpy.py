@@ -0,0 +1,79 @@
+"""
+Test exchanging vectors, matrices and tables with NumPy.
+"""
+import unittest
+import opensim as osim
+
+try:
+    import numpy as np
+except ImportError:
+    np = None
+
+@unittest.skipIf(np is None, 'NumPy is not installed.')
+class TestNumPy(unittest.TestCase):
+    def test_vector_and_matrix_views(self):
+        vec = osim.Vector([1, 2, 3])
+        arr = np.asarray(vec)
+        assert arr.shape == (3,)
+        assert list(arr) == [1, 2, 3]
+        # The array is a view of the Vector.
+        arr[1] = 20
+        assert vec[1] == 20
+
+        mat = osim.Matrix(2, 3, 0.0)
+        mat.set(1, 2, 5.0)
+        arr = np.asarray(mat)
+        assert arr.shape == (2, 3)
+        assert arr[1, 2] == 5.0
+        arr[0, 1] = 7.0
+        assert mat.get(0, 1) == 7.0
+
+        assert np.asarray(osim.Matrix()).shape == (0, 0)
+        assert np.asarray(osim.Matrix(0, 3)).shape == (0, 3)
+        assert np.asarray(osim.Vector()).shape == (0,)
+
+    def test_create_from_numpy(self):
+        data = np.arange(12.0).reshape(4, 3)
+        mat = osim.Matrix.createFromNumPy(data)
+        assert mat.nrow() == 4 and mat.ncol() == 3
+        assert mat.get(2, 1) == data[2, 1]
+        # Non-contiguous and integer arrays are converted.
+        vec = osim.Vector.createFromNumPy(np.arange(10)[::2])
+        assert vec.size() == 5 and vec[4] == 8
+
+    def test_tables(self):
+        times = np.linspace(0, 1, 5)
+        data = np.random.rand(5, 3)
+        table = osim.TimeSeriesTable.createFromNumPy(times, data,
+                                                     ['a', 'b', 'c'])
+        assert table.getNumRows() == 5
+        assert list(table.getColumnLabels()) == ['a', 'b', 'c']
+        assert table.getIndependentColumn()[4] == 1.0
+        assert table.getDependentColumn('b')[3] == data[3, 1]
+        assert np.array_equal(np.asarray(table), data)
+        # Modifying the view modifies the table.
+        view = np.asarray(table)
+        view[0, 0] = -1
+        assert table.getDependentColumnAtIndex(0)[0] == -1
+
+        markers = np.random.rand(5, 2, 3)
+        table = osim.TimeSeriesTableVec3.createFromNumPy(times, markers,
+                                                         ['m1', 'm2'])
+        assert table.getNumColumns() == 2
+        assert table.getRowAtIndex(2)[1][0] == markers[2, 1, 0]
+        assert np.array_equal(np.asarray(table), markers)
+
+        # Views of a temporary table keep the table alive.
+        import gc
+        def create_table():
+            return osim.TimeSeriesTable.createFromNumPy(times, data,
+                                                        ['a', 'b', 'c'])
+        matrix = np.asarray(create_table().getMatrix())
+        column = np.asarray(create_table().getDependentColumn('b'))
+        gc.collect()
+        assert np.array_equal(matrix, data)
+        assert np.array_equal(column, data[:, 1])
+
+        # The number of labels must match the number of columns.
+        with self.assertRaises(RuntimeError):
+            osim.TimeSeriesTable.createFromNumPy(times, data, ['a'])
@@ -362,6 +362,7 @@ DATATABLE_CLONE(double, SimTK::SpatialVec)
 %shared_ptr(OpenSim::CSVFileAdapter)
 %shared_ptr(OpenSim::TRCFileAdapter)
 %shared_ptr(OpenSim::C3DFileAdapter)
+%shared_ptr(OpenSim::NativeC3DFileAdapter)
 %template(StdMapStringDataAdapter)
         std::map<std::string, std::shared_ptr<OpenSim::DataAdapter>>;
 %template(StdMapStringAbstractDataTable)
@@ -378,6 +379,7 @@ namespace OpenSim {
     %ignore TRCFileAdapter::TRCFileAdapter(TRCFileAdapter &&);
     %ignore DelimFileAdapter::DelimFileAdapter(DelimFileAdapter &&);
     %ignore CSVFileAdapter::CSVFileAdapter(CSVFileAdapter &&);
+    %ignore NativeC3DFileAdapter::NativeC3DFileAdapter(NativeC3DFileAdapter &&);
 }
 %include <OpenSim/Common/TRCFileAdapter.h>
 %include <OpenSim/Common/DelimFileAdapter.h>
@@ -396,6 +398,7 @@ namespace OpenSim {
 
 %include <OpenSim/Common/CSVFileAdapter.h>
 %include <OpenSim/Common/XsensDataReader.h>
+%include <OpenSim/Common/NativeC3DFileAdapter.h>
 %include <OpenSim/Common/C3DFileAdapter.h>
 
 %extend OpenSim::C3DFileAdapter {
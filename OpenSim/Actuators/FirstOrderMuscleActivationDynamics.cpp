@@ -114,6 +114,26 @@ getActivation(const SimTK::State& s) const
     return clampToValidInterval(getStateVariableValue(s, STATE_NAME_ACTIVATION));
 }
 
+bool FirstOrderMuscleActivationDynamics::
+hasImplicitForm(const std::string& name) const
+{
+    return name == STATE_NAME_ACTIVATION;
+}
+
+double FirstOrderMuscleActivationDynamics::
+calcStateVariableImplicitResidual(const SimTK::State& s,
+                                  const std::string& name,
+                                  double derivative) const
+{
+    if (!hasImplicitForm(name))
+        return Super::calcStateVariableImplicitResidual(s, name, derivative);
+
+    const double excitation = clampToValidInterval(getExcitation(s));
+    const double activation = getActivation(s);
+    return calcActivationTimeConstant(excitation, activation) * derivative
+           - (excitation - activation);
+}
+
 void FirstOrderMuscleActivationDynamics::setActivation(SimTK::State& s,
                                                        double activation) const
 {
@@ -140,8 +160,14 @@ calcActivationDerivative(double excitation, double activation) const
 {
     excitation = clampToValidInterval(excitation);
     activation = clampToValidInterval(activation);
-    double tau = (excitation > activation)
-                 ? getActivationTimeConstant() * (0.5 + 1.5*activation)
-                 : getDeactivationTimeConstant() / (0.5 + 1.5*activation);
-    return (excitation-activation)/tau;
+    return (excitation-activation) /
+           calcActivationTimeConstant(excitation, activation);
+}
+
+double FirstOrderMuscleActivationDynamics::
+calcActivationTimeConstant(double excitation, double activation) const
+{
+    return (excitation > activation)
+           ? getActivationTimeConstant() * (0.5 + 1.5*activation)
+           : getDeactivationTimeConstant() / (0.5 + 1.5*activation);
 }
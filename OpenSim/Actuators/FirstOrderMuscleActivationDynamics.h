@@ -154,6 +154,14 @@ public:
     /** Get the current activation from the state. **/
     double getActivation(const SimTK::State& s) const override;
 
+    /** Activation has an implicit form, tau*adot - (e - a) = 0, which does not
+        divide by the time constant. **/
+    bool hasImplicitForm(const std::string& name) const override;
+
+    /** The residual of the implicit form of the activation dynamics. **/
+    double calcStateVariableImplicitResidual(const SimTK::State& s,
+            const std::string& name, double derivative) const override;
+
     /** %Set activation state variable to the value provided. **/
     void setActivation(SimTK::State& s, double activation) const override;
 
@@ -169,6 +177,11 @@ private:
         value. **/
     double calcActivationDerivative(double excitation, double activation) const;
 
+    /** The activation or deactivation time constant, depending on whether
+        activation is increasing or decreasing. **/
+    double calcActivationTimeConstant(double excitation,
+                                      double activation) const;
+
     static const std::string STATE_NAME_ACTIVATION;
 
 }; // end of class FirstOrderMuscleActivationDynamics
@@ -996,6 +996,51 @@ void Millard2012EquilibriumMuscle::
     }
 }
 
+bool Millard2012EquilibriumMuscle::
+hasImplicitForm(const std::string& name) const
+{
+    return name == STATE_FIBER_LENGTH_NAME && !get_ignore_tendon_compliance();
+}
+
+double Millard2012EquilibriumMuscle::
+calcStateVariableImplicitResidual(const SimTK::State& s,
+                                  const std::string& name,
+                                  double derivative) const
+{
+    if(!hasImplicitForm(name)) {
+        return Super::calcStateVariableImplicitResidual(s, name, derivative);
+    }
+
+    // As in computeStateVariableDerivatives(), the fiber length does not
+    // change if the muscle is disabled or its actuation is overridden, or if
+    // the fiber is clamped at its minimum length.
+    const MuscleLengthInfo& mli = getMuscleLengthInfo(s);
+    if(!appliesForce(s) || isActuationOverridden(s)
+            || isFiberStateClamped(mli.fiberLength, derivative)) {
+        return derivative;
+    }
+
+    double a = SimTK::NaN;
+    if(!get_ignore_activation_dynamics()) {
+        a = getActivationModel().clampActivation(
+                getStateVariableValue(s, STATE_ACTIVATION_NAME));
+    } else {
+        a = getActivationModel().clampActivation(getControl(s));
+    }
+
+    const double fiso  = getMaxIsometricForce();
+    const double dlceN = derivative /
+                         (getOptimalFiberLength()*getMaxContractionVelocity());
+    const double fv    = get_ForceVelocityCurve().calcValue(dlceN);
+    const SimTK::Vec4 fiberForceV = calcFiberForce(fiso, a,
+            mli.fiberActiveForceLengthMultiplier, fv,
+            mli.fiberPassiveForceLengthMultiplier, dlceN);
+    const double fse =
+            get_TendonForceLengthCurve().calcValue(mli.normTendonLength);
+
+    return fse - fiberForceV[0]*mli.cosPennationAngle/fiso;
+}
+
 //==============================================================================
 // PRIVATE METHODS
 //==============================================================================
@@ -442,6 +442,19 @@ public:
     void computeFiberEquilibrium(SimTK::State& s, 
                                  bool solveForVelocity = false) const;
 
+    /** The fiber length has an implicit form when the tendon is compliant:
+    the equilibrium between the tendon force and the fiber force along the
+    tendon, which uses the force-velocity curve rather than its inverse. */
+    bool hasImplicitForm(const std::string& name) const override;
+
+    /** For the fiber length, the residual is the tendon force minus the fiber
+    force along the tendon at the given fiber velocity, normalized by the
+    maximum isometric force. It is defined for all activations and pennation
+    angles, unlike the fiber velocity of the explicit form. Other state
+    variables use the explicit form. */
+    double calcStateVariableImplicitResidual(const SimTK::State& s,
+            const std::string& name, double derivative) const override;
+
 //==============================================================================
 // DEPRECATED
 //==============================================================================
@@ -136,6 +136,8 @@ Actuation& Actuation::operator=(const Actuation &aActuation)
 
     // Deallocate _fsp if already allocated
     if (_fsp != NULL) { delete[] _fsp;  _fsp = NULL; }
+    _actuators.clear();
+    _scalarActuators.clear();
 
     // STORAGE
     deleteStorage();
@@ -158,6 +160,8 @@ void Actuation::setModel(Model& aModel)
 {
     // BASE CLASS
     Analysis::setModel(aModel);
+    _actuators.clear();
+    _scalarActuators.clear();
 
     // NUMBER OF ACTUATORS
     if (_model){
@@ -368,28 +372,34 @@ record(const SimTK::State& s)
     // TIME NORMALIZATION
     double tReal = s.getTime();
 
+    // The enabled actuators are normally found in begin(). If record() is
+    // called without it, find them here, once, and size the work array and
+    // the column labels for them.
+    if (_fsp == NULL || int(_actuators.size()) != _na) {
+        updateEnabledActuators();
+        _na = int(_actuators.size());
+        if (_fsp != NULL) delete[] _fsp;
+        _fsp = new double[_na];
+        constructColumnLabels();
+    }
+
     // FORCE
-    const Set<Actuator>& fSet = _model->getActuators();
-    for (int i = 0, iact = 0; i<fSet.getSize(); i++) {
-        ScalarActuator* act = dynamic_cast<ScalarActuator*>(&fSet[i]);
-        if(fSet.get(i).get_appliesForce())
-            _fsp[iact++] = act->getActuation(s);
+    for (int i = 0; i < _na; i++) {
+        const ScalarActuator* act = _scalarActuators[i];
+        _fsp[i] = act ? act->getActuation(s) : SimTK::NaN;
     }
     _forceStore->append(tReal, _na, _fsp);
 
     // SPEED
-    for (int i = 0, iact = 0; i<fSet.getSize(); i++) {
-        ScalarActuator* act = dynamic_cast<ScalarActuator*>(&fSet[i]);
-        if(fSet.get(i).get_appliesForce())
-            _fsp[iact++] = act->getSpeed(s);
+    for (int i = 0; i < _na; i++) {
+        const ScalarActuator* act = _scalarActuators[i];
+        _fsp[i] = act ? act->getSpeed(s) : SimTK::NaN;
     }
     _speedStore->append(tReal, _na, _fsp);
 
     // POWER
-    for (int i = 0, iact = 0; i<fSet.getSize(); i++) {
-        if(fSet.get(i).get_appliesForce())
-            _fsp[iact++] = fSet.get(i).getPower(s);
-    }
+    for (int i = 0; i < _na; i++)
+        _fsp[i] = _actuators[i]->getPower(s);
     _powerStore->append(tReal, _na, _fsp);
 
 
@@ -418,8 +428,8 @@ begin(const SimTK::State& s)
     if (!proceed()) return(0);
 
     // NUMBER OF ACTUATORS
-    int na = _model->getActuators().getSize();
-    _na = na;
+    updateEnabledActuators();
+    _na = int(_actuators.size());
     // WORK ARRAY
     if (_fsp != NULL) delete[] _fsp;
     _fsp = new double[_na];
@@ -553,3 +563,20 @@ getNumEnabledActuators()
 
     return numEnabled;
 }
+//_____________________________________________________________________________
+/**
+* Find the enabled actuators, in the order of the storage columns.
+*/
+void Actuation::
+updateEnabledActuators()
+{
+    _actuators.clear();
+    _scalarActuators.clear();
+    const Set<Actuator>& actuators = _model->getActuators();
+    for (int i = 0; i < actuators.getSize(); i++) {
+        if (!actuators[i].get_appliesForce()) continue;
+        _actuators.push_back(&actuators[i]);
+        _scalarActuators.push_back(
+                dynamic_cast<const ScalarActuator*>(&actuators[i]));
+    }
+}
@@ -29,6 +29,7 @@
 //=============================================================================
 #include <OpenSim/Simulation/Model/Analysis.h>
 #include "osimAnalysesDLL.h"
+#include <vector>
 
 
 #ifdef SWIG
@@ -42,6 +43,8 @@
 namespace OpenSim {
 
 class Storage;
+class Actuator;
+class ScalarActuator;
 
     /**
     * A class for recording the basic actuator information for a model
@@ -63,6 +66,11 @@ class Storage;
         int _na;
         /** Work array for storing forces, speeds, or powers. */
         double *_fsp;
+        /** The enabled actuators, in column order, and the same actuators as
+        ScalarActuators (nullptr for those that are not); found in begin()
+        so that record() does not search or cast at every step. */
+        std::vector<const Actuator*> _actuators;
+        std::vector<const ScalarActuator*> _scalarActuators;
         /** Force storage. */
         Storage *_forceStore;
         /** Speed storage. */
@@ -87,6 +95,7 @@ class Storage;
         void deleteStorage();
 
         int getNumEnabledActuators();
+        void updateEnabledActuators();
     public:
         //--------------------------------------------------------------------------
         // OPERATORS
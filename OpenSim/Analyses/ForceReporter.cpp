@@ -28,6 +28,8 @@
 #include "ForceReporter.h"
 #include <OpenSim/Simulation/Model/Model.h>
 
+#include <algorithm>
+
 using namespace OpenSim;
 using namespace std;
 
@@ -150,6 +152,8 @@ void ForceReporter::setModel(Model& aModel)
 {
     // BASE CLASS
     Analysis::setModel(aModel);
+    _recordLayout.clear();
+    _recordRow.clear();
 }
 
 //_____________________________________________________________________________
@@ -202,19 +206,21 @@ void ForceReporter::constructDescription()
  */
 void ForceReporter::constructColumnLabels(const SimTK::State& s)
 {
+    _recordLayout.clear();
+    _recordRow.clear();
     if (_model)
     {
         // ASSIGN
         Array<string> columnLabels;
         columnLabels.append("time");
         
-        auto forces = _model->getComponentList<Force>();
-
-        for(auto& force : forces) {
+        for(const Force* force : _model->getCachedForces()) {
             // If body force we need to record six values for torque+force
             // If muscle we record one scalar
-            if(!force.appliesForce(s)) continue; // Skip over disabled forces
-            Array<string> forceLabels = force.getRecordLabels();
+            if(!force->appliesForce(s)) continue; // Skip over disabled forces
+            Array<string> forceLabels = force->getRecordLabels();
+            _recordLayout.push_back({force, nullptr,
+                    columnLabels.getSize() - 1, forceLabels.getSize()});
             // If prescribed force we need to record point, 
             columnLabels.append(forceLabels);
         }
@@ -226,11 +232,14 @@ void ForceReporter::constructColumnLabels(const SimTK::State& s)
                     continue; // Skip over disabled constraints
                 // Ask constraint how many columns and their names it reports
                 Array<string> forceLabels = c.getRecordLabels();
+                _recordLayout.push_back({nullptr, &c,
+                        columnLabels.getSize() - 1, forceLabels.getSize()});
                 // If prescribed force we need to record point, 
                 columnLabels.append(forceLabels);
             }
         }
         _forceStore.setColumnLabels(columnLabels);
+        _recordRow.resize(columnLabels.getSize() - 1);
     }
 }
 
@@ -261,30 +270,29 @@ int ForceReporter::record(const SimTK::State& s)
     // MAKE SURE ALL ForceReporter QUANTITIES ARE VALID
     _model->getMultibodySystem().realize(s, SimTK::Stage::Dynamics );
 
-    StateVector nextRow(s.getTime());
-
-    // Model Forces
-    auto forces = _model->getComponentList<Force>();
-
-    for(auto& force : forces) {
-        // If body force we need to record six values for torque+force
-        // If muscle we record one scalar
-        if(!force.appliesForce(s)) continue;
-        Array<double> values = force.getRecordValues(s);
-        nextRow.getData().append(values);
-    }
-
-    if(_includeConstraintForces){
-        // Model Constraints
-        auto constraints = _model->getComponentList<Constraint>();
-        for (auto& constraint : constraints) {
-            if (!constraint.isEnforced(s))
-                continue;
-            Array<double> values = constraint.getRecordValues(s);
-            nextRow.getData().append(values);
+    // The layout is normally computed in begin().
+    if(_recordLayout.empty()) constructColumnLabels(s);
+
+    // Each Force and Constraint writes its values into its own slice of the
+    // row. The columns were chosen in begin(); forces or constraints that are
+    // not applied at this time contribute zeros.
+    double* row = _recordRow.data();
+    for(const RecordEntry& entry : _recordLayout) {
+        double* values = row + entry.offset;
+        if(entry.force) {
+            if(entry.force->appliesForce(s))
+                entry.force->fillRecordValues(s, values, entry.size);
+            else
+                std::fill(values, values + entry.size, 0.0);
+        }
+        else {
+            if(entry.constraint->isEnforced(s))
+                entry.constraint->fillRecordValues(s, values, entry.size);
+            else
+                std::fill(values, values + entry.size, 0.0);
         }
     }
-    _forceStore.append(nextRow);
+    _forceStore.append(s.getTime(), int(_recordRow.size()), row);
 
     return(0);
 }
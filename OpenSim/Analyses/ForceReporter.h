@@ -29,6 +29,7 @@
 //=============================================================================
 #include <OpenSim/Simulation/Model/Analysis.h>
 #include "osimAnalysesDLL.h"
+#include <vector>
 
 #ifdef SWIG
     #ifdef OSIMANALYSES_API
@@ -40,6 +41,9 @@
 //=============================================================================
 namespace OpenSim { 
 
+class Force;
+class Constraint;
+
 /**
  * A class for recording the Forces applied to a model
  * during a simulation.
@@ -64,6 +68,18 @@ protected:
     /** Force storage. */
     Storage _forceStore;
 
+    /** Where each recorded Force or Constraint writes its values in a row.
+    The layout is computed once in begin(), with the column labels, so that
+    record() fills the preallocated _recordRow without allocating. */
+    struct RecordEntry {
+        const Force* force;
+        const Constraint* constraint;
+        int offset;
+        int size;
+    };
+    std::vector<RecordEntry> _recordLayout;
+    std::vector<double> _recordRow;
+
 //=============================================================================
 // METHODS
 //=============================================================================
@@ -27,6 +27,7 @@
 #include <OpenSim/Common/IO.h>
 #include <OpenSim/Simulation/Model/Model.h>
 #include <OpenSim/Simulation/Model/ExternalForce.h>
+#include <OpenSim/Simulation/Model/Muscle.h>
 #include "InducedAccelerations.h"
 
 using namespace OpenSim;
@@ -456,6 +457,12 @@ void InducedAccelerations::setupStorage()
         _storeConstraintReactions->setColumnLabels(constReactionLabels);
     }
 
+    _storageList.setSize(0);
+    for(int i=0; i<_storeInducedAccelerations.getSize(); i++)
+        _storageList.append(_storeInducedAccelerations[i]);
+    if(_reportConstraintReactions)
+        _storageList.append(_storeConstraintReactions);
+
     _coordSet.setMemoryOwner(false);
     _bodySet.setMemoryOwner(false);
 }
@@ -540,8 +547,15 @@ int InducedAccelerations::record(const SimTK::State& s)
     //Use same conditions on constraints
     s_analysis.setTime(aT);
 
+    // The contributors other than "total" differ only in the forces they
+    // apply, so when possible they are solved together after "total".
+    bool solveTogether = canSolveContributorsTogether(s_analysis);
+
     // Cycle through the force contributors to the system acceleration
     for(int c=0; c< _contributors.getSize(); c++){          
+        if(solveTogether && _contributors[c] != "total")
+            continue;
+
         //cout << "Solving for contributor: " << _contributors[c] << endl;
         // Need to be at the dynamics stage to disable a force
         _model->getMultibodySystem().realize(s_analysis, SimTK::Stage::Dynamics);
@@ -765,6 +779,9 @@ int InducedAccelerations::record(const SimTK::State& s)
 
     } // End cycling through contributors at this time step
 
+    if(solveTogether)
+        recordContributorsTogether(s, s_analysis);
+
     // Set the accelerations of coordinates into their storages
     int nc = _coordSet.getSize();
     for(int i=0; i<nc; i++) {
@@ -788,6 +805,221 @@ int InducedAccelerations::record(const SimTK::State& s)
     return(0);
 }
 
+//_____________________________________________________________________________
+/**
+ * The contributors can be solved together unless constraint reactions are
+ * reported (these are only available from a realized state), a coordinate
+ * is prescribed (its acceleration is not determined by the constraint
+ * equations), or an actuator is not a ScalarActuator.
+ */
+bool InducedAccelerations::
+canSolveContributorsTogether(const SimTK::State& s) const
+{
+    if(_reportConstraintReactions) return false;
+
+    const CoordinateSet& coords = _model->getCoordinateSet();
+    for(int i=0; i<coords.getSize(); i++)
+        if(coords.get(i).isPrescribed(s)) return false;
+
+    const Set<Actuator>& actuators = _model->getActuators();
+    for(int f=0; f<actuators.getSize(); f++)
+        if(!dynamic_cast<const ScalarActuator*>(&actuators.get(f)))
+            return false;
+
+    return true;
+}
+
+//_____________________________________________________________________________
+/**
+ * At a given frame the mass matrix M and the constraint Jacobian G are the
+ * same for every contributor; only the net generalized force f and the
+ * acceleration constraint bias b differ. The accelerations of all the
+ * contributors are therefore found by factoring
+ *
+ *     [ M  ~G ] [ udot   ]   [ f ]
+ *     [ G   0 ] [ lambda ] = [ b ]
+ *
+ * once and solving for one right-hand side per contributor. This replaces
+ * realizing the model to Acceleration once per contributor.
+ *
+ * As when each contributor is realized separately, the forces that are not
+ * actuators or gravity apply to every contributor, evaluated at zero speed
+ * for gravity and the actuators and at the current speed for "velocity".
+ */
+void InducedAccelerations::
+recordContributorsTogether(const SimTK::State& s, const SimTK::State& s_analysis)
+{
+    const SimTK::MultibodySystem& system = _model->getMultibodySystem();
+    const SimTK::SimbodyMatterSubsystem& matter = _model->getMatterSubsystem();
+    const SimTK::ForceIndex gravityIndex = _model->getGravityForce().getForceIndex();
+    Set<Actuator>& actuators = _model->updActuators();
+    const int nu = s.getNU();
+    const int nb = matter.getNumBodies();
+
+    // Gravity and actuators are evaluated at zero speed, "velocity" at the
+    // current speed. Set up one state for each kind of contributor.
+    SimTK::State sGravity = s_analysis;
+    sGravity.setQ(s.getQ());
+    sGravity.setU(SimTK::Vector(nu, 0.0));
+    sGravity.setZ(s.getZ());
+    SimTK::State sVelocity = sGravity;
+    sVelocity.setU(s.getU());
+    SimTK::State sActuators = sGravity;
+
+    _model->updForceSubsystem().setForceIsDisabled(sGravity, gravityIndex, false);
+    _model->updForceSubsystem().setForceIsDisabled(sVelocity, gravityIndex, true);
+    _model->updForceSubsystem().setForceIsDisabled(sActuators, gravityIndex, true);
+    for(int f=0; f<actuators.getSize(); f++){
+        ScalarActuator& act = static_cast<ScalarActuator&>(actuators.get(f));
+        act.setAppliesForce(sGravity, false);
+        act.setAppliesForce(sVelocity, false);
+        act.setAppliesForce(sActuators, true);
+        act.overrideActuation(sActuators, false);
+        if(_computePotentialsOnly && dynamic_cast<Muscle*>(&act)){
+            act.overrideActuation(sActuators, true);
+            act.setOverrideActuation(sActuators, 1.0);
+        }
+    }
+    system.realize(sGravity, SimTK::Stage::Dynamics);
+    system.realize(sVelocity, SimTK::Stage::Dynamics);
+    system.realize(sActuators, SimTK::Stage::Dynamics);
+
+    // Net generalized force (applied forces less Coriolis and gyroscopic
+    // forces) of the given body and mobility forces.
+    auto calcNetForce = [&](const SimTK::State& sc,
+            const SimTK::Vector& mobilityForces,
+            const SimTK::Vector_<SimTK::SpatialVec>& bodyForces) {
+        SimTK::Vector residual;
+        matter.calcResidualForceIgnoringConstraints(sc, mobilityForces,
+                bodyForces, SimTK::Vector(), residual);
+        residual *= -1;
+        return residual;
+    };
+    auto calcSystemNetForce = [&](const SimTK::State& sc) {
+        return calcNetForce(sc,
+                system.getMobilityForces(sc, SimTK::Stage::Dynamics),
+                system.getRigidBodyForces(sc, SimTK::Stage::Dynamics));
+    };
+
+    // The forces of each actuator, and those of everything else at zero
+    // speed and without gravity.
+    SimTK::Matrix actuatorForces(nu, actuators.getSize());
+    SimTK::Vector otherForces = calcSystemNetForce(sActuators);
+    SimTK::Vector_<SimTK::SpatialVec> bodyForces;
+    SimTK::Vector mobilityForces;
+    for(int f=0; f<actuators.getSize(); f++){
+        actuators.get(f).calcForceContribution(sActuators, bodyForces, mobilityForces);
+        actuatorForces(f) = calcNetForce(sActuators, mobilityForces, bodyForces);
+        otherForces -= actuatorForces(f);
+    }
+
+    // Factor the constrained equations of motion once.
+    SimTK::Matrix M, G;
+    matter.calcM(sGravity, M);
+    matter.calcG(sGravity, G);
+    const int nm = G.nrow();
+    SimTK::Matrix K(nu+nm, nu+nm, 0.0);
+    K(0, 0, nu, nu) = M;
+    if(nm > 0){
+        K(0, nu, nu, nm) = ~G;
+        K(nu, 0, nm, nu) = G;
+    }
+    SimTK::FactorQTZ kkt(K);
+
+    SimTK::Vector zeroSpeedBias, velocityBias;
+    matter.calcBiasForAccelerationConstraints(sGravity, zeroSpeedBias);
+    matter.calcBiasForAccelerationConstraints(sVelocity, velocityBias);
+    zeroSpeedBias *= -1;
+    velocityBias *= -1;
+
+    // One right-hand side per contributor, in the order of the contributors.
+    Array<int> columns;
+    for(int c=0; c<_contributors.getSize(); c++)
+        if(_contributors[c] != "total") columns.append(c);
+    const int ncol = columns.getSize();
+
+    SimTK::Matrix rhs(nu+nm, ncol);
+    for(int j=0; j<ncol; j++){
+        const string& contributor = _contributors[columns[j]];
+        const bool isVelocity = (contributor == "velocity");
+        if(contributor == "gravity")
+            rhs(j)(0, nu) = calcSystemNetForce(sGravity);
+        else if(isVelocity)
+            rhs(j)(0, nu) = calcSystemNetForce(sVelocity);
+        else{
+            int ai = actuators.getIndex(contributor);
+            if(ai<0)
+                throw Exception("InducedAcceleration: ERR- Could not find actuator '"+contributor,__FILE__,__LINE__);
+            SimTK::Vector f = otherForces;
+            f += actuatorForces(ai);
+            rhs(j)(0, nu) = f;
+        }
+        if(nm > 0)
+            rhs(j)(nu, nm) = isVelocity ? velocityBias : zeroSpeedBias;
+    }
+
+    SimTK::Matrix solution;
+    kkt.solve(rhs, solution);
+
+    // Report the kinematics implied by each contributor's accelerations.
+    for(int j=0; j<ncol; j++){
+        const bool isVelocity = (_contributors[columns[j]] == "velocity");
+        const SimTK::State& sc = isVelocity ? sVelocity : sGravity;
+        const SimTK::Vector udot(solution(j)(0, nu));
+
+        SimTK::Vector_<SimTK::SpatialVec> A_GB;
+        matter.multiplyBySystemJacobian(sc, udot, A_GB);
+        if(isVelocity){
+            SimTK::Vector_<SimTK::SpatialVec> JDotu;
+            matter.calcBiasForSystemJacobian(sc, JDotu);
+            A_GB += JDotu;
+        }
+
+        // Acceleration in ground of a station fixed on a mobilized body.
+        auto stationAcceleration = [&](const SimTK::MobilizedBody& mobod,
+                                       const SimTK::Vec3& station) {
+            const SimTK::SpatialVec& A = A_GB[mobod.getMobilizedBodyIndex()];
+            const SimTK::Vec3 r = mobod.getBodyRotation(sc) * station;
+            const SimTK::Vec3& w = mobod.getBodyAngularVelocity(sc);
+            return SimTK::Vec3(A[1] + A[0] % r + w % (w % r));
+        };
+
+        for(int i=0;i<_coordSet.getSize();i++) {
+            const Coordinate& coord = _coordSet.get(i);
+            const SimTK::MobilizedBody& mobod =
+                matter.getMobilizedBody(coord.getBodyIndex());
+            double acc = udot[int(mobod.getFirstUIndex(sc)) + coord.getMobilizerQIndex()];
+            if(getInDegrees())
+                acc *= SimTK_RADIAN_TO_DEGREE;
+            _coordIndAccs[i]->append(1, &acc);
+        }
+
+        for(int i=0;i<_bodySet.getSize();i++) {
+            const Body& body = _bodySet.get(i);
+            const SimTK::MobilizedBody& mobod = body.getMobilizedBody();
+            SimTK::Vec3 vec = stationAcceleration(mobod, body.get_mass_center());
+            SimTK::Vec3 angVec = A_GB[mobod.getMobilizedBodyIndex()][0];
+            if(getInDegrees())
+                angVec *= SimTK_RADIAN_TO_DEGREE;
+            _bodyIndAccs[i]->append(3, &vec[0]);
+            _bodyIndAccs[i]->append(3, &angVec[0]);
+        }
+
+        if(_includeCOM){
+            SimTK::Vec3 vec(0);
+            double mass = 0;
+            for(SimTK::MobilizedBodyIndex mbx(1); mbx < nb; ++mbx){
+                const SimTK::MobilizedBody& mobod = matter.getMobilizedBody(mbx);
+                const double m = mobod.getBodyMass(sc);
+                vec += m*stationAcceleration(mobod, mobod.getBodyMassCenterStation(sc));
+                mass += m;
+            }
+            vec /= mass;
+            _comIndAccs.append(3, &vec[0]);
+        }
+    }
+}
+
 /**
  * This method is called at the beginning of an analysis so that any
  * necessary initializations may be performed.
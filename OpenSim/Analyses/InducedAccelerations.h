@@ -218,6 +218,15 @@ protected:
 
     Array<bool> applyConstraintsAccordingToExternalForces(SimTK::State &s);
 
+    /** Whether the accelerations induced by all contributors other than
+        "total" can be found from a single factorization of the constrained
+        equations of motion (see recordContributorsTogether()). */
+    bool canSolveContributorsTogether(const SimTK::State &s) const;
+    /** Append the accelerations induced by every contributor except
+        "total", in the order of the contributors, to the work arrays. */
+    void recordContributorsTogether(const SimTK::State &s,
+                                    const SimTK::State &s_analysis);
+
 //=============================================================================
 }; // END of class InducedAccelerations
 }; //namespace
@@ -143,6 +143,8 @@ operator=(const JointReaction &aJointReaction)
     _inFrame = aJointReaction._inFrame;
     _useForceStorage = aJointReaction._useForceStorage;
     _storeActuation = NULL;
+    _actuatorColumns.clear();
+    _hasOverrideState = false;
     return(*this);
 }
 
@@ -168,6 +170,7 @@ setNull()
     _inFrame[0] = "ground";
 
     _storeActuation = NULL;
+    _hasOverrideState = false;
 
 }
 //_____________________________________________________________________________
@@ -414,6 +417,7 @@ constructColumnLabels()
 void JointReaction::loadForcesFromFile()
 {
     delete _storeActuation; _storeActuation = NULL;
+    _actuatorColumns.clear();
     // check if the forces storage file name is valid and, if so, load the file into storage
     if(_forcesFileNameProp.isValidFileName()) {
         
@@ -432,18 +436,26 @@ void JointReaction::loadForcesFromFile()
             _containsAllActuators = false;
         }
         else {
+            // Resolve the column of each actuator once, rather than every
+            // time the forces are applied.
             for(int actuatorIndex=0;actuatorIndex<actuatorSetSize;actuatorIndex++)
             {
-                std::string actuatorName = _model->getActuators().get(actuatorIndex).getName();
+                const Actuator& actuator = _model->getActuators().get(actuatorIndex);
+                const std::string& actuatorName = actuator.getName();
                 int storageIndex = _storeActuation->getStateIndex(actuatorName,0);
                 if(storageIndex == -1) {
                     cout << "\nThe actuator " << actuatorName << " was not found in the forces file." << endl;
                     _containsAllActuators = false;
                 }
+                else if(const ScalarActuator* act =
+                        dynamic_cast<const ScalarActuator*>(&actuator)) {
+                    _actuatorColumns.emplace_back(act, storageIndex);
+                }
             }
         }
 
         if(_containsAllActuators) {
+            _actuatorForces.setSize(storeSize);
             if(storeSize> actuatorSetSize) cout << "\nWARNING:  The forces file contains actuators that are not in the model's actuator set." << endl;
             _useForceStorage = true;
             cout << "WARNING:  Ignoring fiber lengths and activations from the states since " << _forcesFileNameProp.getName() << " is also set." << endl;
@@ -451,6 +463,7 @@ void JointReaction::loadForcesFromFile()
         }
         else {
             _useForceStorage = false;
+            _actuatorColumns.clear();
             cout << "Actuator forces will be constructed from the states." << endl;
         }
     }
@@ -477,6 +490,8 @@ setupStorage()
     _storeReactionLoads.setName("Joint Reaction Loads");
     _storeReactionLoads.setDescription(getDescription());
     _storeReactionLoads.setColumnLabels(getColumnLabels());
+    _storageList.setSize(0);
+    _storageList.append(&_storeReactionLoads);
 
     // Actuator forces - if a forces file is specified, load the forces storage data to _storeActuation
     if(!(_forcesFileName == "")) loadForcesFromFile();
@@ -519,6 +534,20 @@ setModel(Model& aModel)
 //=============================================================================
 // ANALYSIS
 //=============================================================================
+//_____________________________________________________________________________
+/**
+ * Copy the state into the scratch state in which record() overrides the
+ * actuation with the forces file, and enable the overrides.
+ */
+void JointReaction::
+initializeOverrideState(const SimTK::State& s)
+{
+    _overrideState = s;
+    for(const auto& column : _actuatorColumns)
+        column.first->overrideActuation(_overrideState, true);
+    _hasOverrideState = true;
+}
+
 //_____________________________________________________________________________
 /**
  * Compute and record the results.
@@ -536,51 +565,67 @@ int JointReaction::
 record(const SimTK::State& s)
 {
     /** if a forces file is specified replace the computed actuation with the 
-        forces from storage.*/
-    SimTK::State s_analysis = s;
-
-    _model->updMultibodySystem().realize(s_analysis, s.getSystemStage());
+        forces from storage. The actuation is overridden in a scratch state,
+        which is copied from the first state and afterwards only updated
+        with the time, q, u and z of each state.*/
+    const SimTK::State* analysisState = &s;
     if(_useForceStorage){
-        const auto& actuatorSet = _model->getActuators();
-        int nA = actuatorSet.getSize();
-        Array<double> forces(0,nA);
-        _storeActuation->getDataAtTime(s.getTime(),nA,forces);
-        int storageIndex = -1;
-        for(int actuatorIndex=0;actuatorIndex<nA;actuatorIndex++)
-        {
-            //Actuator* act = dynamic_cast<Actuator*>(&_forceSet->get(actuatorIndex));
-            std::string actuatorName = actuatorSet.get(actuatorIndex).getName();
-            storageIndex = _storeActuation->getStateIndex(actuatorName, 0);
-            if(storageIndex == -1){
-                cout << "The actuator, " << actuatorName << ", was not found in the forces file." << endl;
-                break;
-            }
-            const ScalarActuator* act = dynamic_cast<const ScalarActuator*>(&actuatorSet[actuatorIndex]);
-            if (act){
-                act->overrideActuation(s_analysis, true);
-                act->setOverrideActuation(s_analysis, forces[storageIndex]);
-            }
+        if(!_hasOverrideState
+                || _overrideState.getNQ() != s.getNQ()
+                || _overrideState.getNU() != s.getNU()
+                || _overrideState.getNZ() != s.getNZ()) {
+            initializeOverrideState(s);
+        } else {
+            _overrideState.setTime(s.getTime());
+            _overrideState.updQ() = s.getQ();
+            _overrideState.updU() = s.getU();
+            _overrideState.updZ() = s.getZ();
         }
+        _storeActuation->getDataAtTime(s.getTime(),
+                _actuatorForces.getSize(), _actuatorForces);
+        for(const auto& column : _actuatorColumns)
+            column.first->setOverrideActuation(_overrideState,
+                                               _actuatorForces[column.second]);
+        analysisState = &_overrideState;
     }
+    const SimTK::State& s_analysis = *analysisState;
+
     // VARIABLES
     const Ground& ground = _model->getGround();
 
     _model->realizeAcceleration(s_analysis);
 
+    /* The reactions of all mobilizers are computed at once, at the origin of
+    *  the mobilizer frame on the child (M) and expressed in ground. Finding
+    *  them joint by joint would repeat this computation for every joint.*/
+    const SimbodyMatterSubsystem& matter = _model->getMatterSubsystem();
+    matter.calcMobilizerReactionForces(s_analysis, _mobilizerReactions);
+
     /* retrieved desired joint reactions, convert to desired bodies, and convert
     *  to desired reference frames*/
     int numOutputJoints = _reactionList.getSize();
     Vector_<Vec3> forcesVec(numOutputJoints), momentsVec(numOutputJoints), pointsVec(numOutputJoints);
     for(int i=0; i<numOutputJoints; i++) {
-        JointReactionKey currentKey = _reactionList[i];
+        const JointReactionKey& currentKey = _reactionList[i];
         const Joint& joint = *currentKey.joint;
         const Frame& expressedInBody = *currentKey.expressedInFrame;
+        const MobilizedBody& mobod = joint.getChildFrame().getMobilizedBody();
+        const SpatialVec& reactionOnChild =
+            _mobilizerReactions[mobod.getMobilizedBodyIndex()];
         SpatialVec jointReaction;
         Vec3 pointOfApplication;
         
         // check if the load requested is on the parent or child
         if(!currentKey.isAppliedOnChild){
-            jointReaction = joint.calcReactionOnParentExpressedInGround(s_analysis);
+            // the reaction on the parent is equal and opposite to the
+            // reaction on the child, acting at the mobilizer frame on the
+            // parent (F).
+            const Vec3 p_GM = (mobod.getBodyTransform(s_analysis) *
+                               mobod.getOutboardFrame(s_analysis)).p();
+            const Vec3 p_GF = (mobod.getParentMobilizedBody()
+                                       .getBodyTransform(s_analysis) *
+                               mobod.getInboardFrame(s_analysis)).p();
+            jointReaction = -shiftForceFromTo(reactionOnChild, p_GM, p_GF);
 
             // find the point of application in immediate parent frame, then
             // transform to the base frame of the parent (expressedInBody)
@@ -589,7 +634,7 @@ record(const SimTK::State& s)
                 ground.findStationLocationInAnotherFrame(s_analysis, parentLocationInGlobal, expressedInBody);
         }
         else{
-            jointReaction = joint.calcReactionOnChildExpressedInGround(s_analysis);
+            jointReaction = reactionOnChild;
 
             // find the point of application in immediate child frame, then
             // transform to the base frame of the child (expressedInBody)
@@ -640,6 +685,7 @@ begin(const SimTK::State& s)
     if(!proceed()) return(0);
     // Read forces file here rather than during initialization
     setupStorage();
+    _hasOverrideState = false;
 
     // RESET STORAGE
     _storeReactionLoads.reset(s.getTime());
@@ -39,6 +39,7 @@ namespace OpenSim {
 
 class Model;
 class Joint;
+class ScalarActuator;
 
 
 /**
@@ -137,6 +138,18 @@ protected:
 
     bool _useForceStorage;
 
+    /** The actuators whose actuation is overridden with the forces file and
+    *   their columns in _storeActuation, resolved when the file is loaded.*/
+    std::vector<std::pair<const ScalarActuator*, int>> _actuatorColumns;
+    /** Internal work array for a row of _storeActuation.*/
+    Array<double> _actuatorForces;
+    /** Scratch state in which the actuation is overridden with the forces
+    *   file. It is created by begin() and updated in place by record().*/
+    SimTK::State _overrideState;
+    bool _hasOverrideState;
+    /** Internal work array for the mobilizer reactions of all bodies.*/
+    SimTK::Vector_<SimTK::SpatialVec> _mobilizerReactions;
+
 //=============================================================================
 // METHODS
 //=============================================================================
@@ -208,6 +221,7 @@ protected:
     void constructColumnLabels();
     void setupStorage();
     void loadForcesFromFile();
+    void initializeOverrideState(const SimTK::State& s);
 
 //=============================================================================
 }; // END of class JointReaction
@@ -411,6 +411,7 @@ MuscleAnalysis& MuscleAnalysis::operator=(const MuscleAnalysis &aAnalysis)
     _coordinateListProp = aAnalysis._coordinateListProp;
     _computeMomentsProp = aAnalysis._computeMomentsProp;
     _computeMoments = _computeMomentsProp.getValueBool();
+    _geometryTable = aAnalysis._geometryTable;
     allocateStorageObjects();
 
     return (*this);
@@ -533,6 +534,16 @@ int MuscleAnalysis::record(const SimTK::State& s)
     bool forceWarning = false;
     bool dynamicsWarning = false;
 
+    // Muscles whose moment arms are interpolated from the table.
+    std::vector<int> tableMuscles(nm, -1);
+    std::vector<double> tableQ;
+    if (_geometryTable) {
+        for (int i = 0; i < nm; ++i)
+            tableMuscles[i] =
+                _geometryTable->getMuscleIndex(_muscleArray[i]->getName());
+        tableQ = _geometryTable->getCoordinateValues(*_model, s);
+    }
+
     for(int i=0; i<nm; ++i) {
         try{
             len[i] = _muscleArray[i]->getLength(s);
@@ -656,9 +667,15 @@ int MuscleAnalysis::record(const SimTK::State& s)
             // bool locked = q->getLocked(s);
 
             _model->getMultibodySystem().realize(s, s.getSystemStage());
+            const int tableCoord = _geometryTable ?
+                _geometryTable->getCoordinateIndex(q->getName()) : -1;
             // LOOP OVER MUSCLES
             for(int j=0; j<nm; j++) {
-                ma[j] = _muscleArray[j]->computeMomentArm(s,*q);
+                if (tableMuscles[j] >= 0 && tableCoord >= 0)
+                    ma[j] = _geometryTable->calcMomentArm(tableMuscles[j],
+                                                          tableCoord, tableQ);
+                else
+                    ma[j] = _muscleArray[j]->computeMomentArm(s,*q);
                 m[j] = ma[j] * force[j];
             }
             maStore->append(s.getTime(),nm,&ma[0]);
@@ -30,8 +30,11 @@
 //=============================================================================
 #include <OpenSim/Simulation/Model/Analysis.h>
 #include <OpenSim/Simulation/Model/Muscle.h>
+#include "MuscleGeometryTable.h"
 #include "osimAnalysesDLL.h"
 
+#include <memory>
+
 
 #ifdef SWIG
     #ifdef OSIMANALYSES_API
@@ -140,6 +143,10 @@ private:
 #endif
     /** Array of active muscles. */
     ArrayPtrs<Muscle> _muscleArray;
+#ifndef SWIG
+    /** Optional table of muscle lengths and moment arms. */
+    std::shared_ptr<const MuscleGeometryTable> _geometryTable;
+#endif
 
 //=============================================================================
 // METHODS
@@ -220,6 +227,20 @@ public:
     }
 #ifndef SWIG
     const ArrayPtrs<StorageCoordinatePair>& getMomentArmStorageArray() const { return _momentArmStorageArray; }
+
+    /** Interpolate the moment arms of the muscles in `table` about the
+    coordinates in `table` instead of computing them from the path geometry
+    of each frame. Only the cost of the moment arms is saved: the tendon and
+    fiber quantities depend on the path, so the lengths and all the other
+    quantities are still computed from the model, and each row stays
+    consistent with it. The table may be shared by several analyses; pass
+    nullptr to stop using it. */
+    void setGeometryTable(std::shared_ptr<const MuscleGeometryTable> table) {
+        _geometryTable = std::move(table);
+    }
+    const std::shared_ptr<const MuscleGeometryTable>& getGeometryTable() const {
+        return _geometryTable;
+    }
 #endif
     //--------------------------------------------------------------------------
     // ANALYSIS
@@ -0,0 +1,328 @@
+/* -------------------------------------------------------------------------- *
+ *                   OpenSim:  MuscleGeometryTable.cpp                        *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2019 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "MuscleGeometryTable.h"
+#include <OpenSim/Simulation/Model/Model.h>
+#include <OpenSim/Simulation/Model/Muscle.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+using namespace OpenSim;
+
+namespace {
+    // Number of values of each coordinate at which the muscle lengths are
+    // compared to find the coordinates that the muscles span.
+    const int NumSpanSamples = 5;
+    // Smallest change in length (m) of a muscle that spans a coordinate.
+    const double SpanTolerance = 1e-9;
+
+    double calcGridValue(const MuscleGeometryTable::CoordinateRange& range,
+                         int i)
+    {
+        return range.min + i * (range.max - range.min) / (range.numPoints - 1);
+    }
+}
+
+//_____________________________________________________________________________
+/**
+ * Muscles that span the same coordinates share a grid, so the model is posed
+ * once per grid point for all of them.
+ */
+MuscleGeometryTable::MuscleGeometryTable(const Model& model,
+        const std::vector<CoordinateRange>& ranges,
+        const std::vector<std::string>& muscles) : _ranges(ranges)
+{
+    for (const auto& range : _ranges) {
+        OPENSIM_THROW_IF(!model.getCoordinateSet().contains(range.name),
+                Exception, "Coordinate '" + range.name +
+                "' is not in model '" + model.getName() + "'.");
+        OPENSIM_THROW_IF(range.numPoints < 2 || !(range.max > range.min),
+                Exception, "Expected at least 2 points over a nonempty range "
+                "for coordinate '" + range.name + "'.");
+    }
+
+    const Set<Muscle>& modelMuscles = model.getMuscles();
+    std::vector<int> indices;
+    if (muscles.empty()) {
+        for (int i = 0; i < modelMuscles.getSize(); ++i)
+            indices.push_back(i);
+    }
+    for (const auto& name : muscles) {
+        const int i = modelMuscles.getIndex(name);
+        OPENSIM_THROW_IF(i < 0, Exception, "Muscle '" + name +
+                "' is not in model '" + model.getName() + "'.");
+        indices.push_back(i);
+    }
+
+    const std::vector<std::vector<int>> spanned =
+            findSpannedCoordinates(model, indices);
+    std::map<std::vector<int>, std::vector<int>> groups;
+    _muscles.resize(indices.size());
+    for (int k = 0; k < (int)indices.size(); ++k) {
+        _muscles[k].name = modelMuscles[indices[k]].getName();
+        _muscles[k].coordinates = spanned[k];
+        _muscleIndices[_muscles[k].name] = k;
+        groups[spanned[k]].push_back(k);
+    }
+
+    for (const auto& group : groups) {
+        SimTK::State s = model.getWorkingState();
+        const std::vector<int>& coordinates = group.first;
+        int numGridPoints = 1;
+        for (int c : coordinates)
+            numGridPoints *= _ranges[c].numPoints;
+        for (int k : group.second) {
+            _muscles[k].lengths.resize(numGridPoints);
+            _muscles[k].momentArms.assign(coordinates.size(),
+                    std::vector<double>(numGridPoints));
+        }
+
+        std::vector<double> values(coordinates.size());
+        for (int n = 0; n < numGridPoints; ++n) {
+            int index = n;
+            for (int j = 0; j < (int)coordinates.size(); ++j) {
+                const CoordinateRange& range = _ranges[coordinates[j]];
+                values[j] = calcGridValue(range, index % range.numPoints);
+                index /= range.numPoints;
+            }
+            setCoordinateValues(model, s, coordinates, values);
+
+            for (int k : group.second) {
+                const GeometryPath& path =
+                        modelMuscles[indices[k]].getGeometryPath();
+                _muscles[k].lengths[n] = path.getLength(s);
+                for (int j = 0; j < (int)coordinates.size(); ++j)
+                    _muscles[k].momentArms[j][n] = path.computeMomentArm(s,
+                        model.getCoordinateSet().get(
+                                _ranges[coordinates[j]].name));
+            }
+        }
+    }
+}
+
+//_____________________________________________________________________________
+/**
+ * A muscle spans a coordinate if its length changes when the coordinate is
+ * varied over its range, with the other coordinates at their values in the
+ * working state.
+ */
+std::vector<std::vector<int>> MuscleGeometryTable::findSpannedCoordinates(
+        const Model& model, const std::vector<int>& muscles) const
+{
+    const Set<Muscle>& modelMuscles = model.getMuscles();
+    std::vector<std::vector<int>> spanned(muscles.size());
+    for (int c = 0; c < (int)_ranges.size(); ++c) {
+        SimTK::State s = model.getWorkingState();
+        std::vector<double> minLength(muscles.size(), SimTK::Infinity);
+        std::vector<double> maxLength(muscles.size(), -SimTK::Infinity);
+        for (int i = 0; i < NumSpanSamples; ++i) {
+            const double value = _ranges[c].min +
+                    i * (_ranges[c].max - _ranges[c].min) / (NumSpanSamples-1);
+            setCoordinateValues(model, s, {c}, {value});
+            for (int k = 0; k < (int)muscles.size(); ++k) {
+                const double length =
+                        modelMuscles[muscles[k]].getGeometryPath().getLength(s);
+                minLength[k] = std::min(minLength[k], length);
+                maxLength[k] = std::max(maxLength[k], length);
+            }
+        }
+        for (int k = 0; k < (int)muscles.size(); ++k)
+            if (maxLength[k] - minLength[k] > SpanTolerance)
+                spanned[k].push_back(c);
+    }
+    return spanned;
+}
+
+//_____________________________________________________________________________
+/**
+ * Constraints are enforced, and the state realized to Position, only when
+ * the last value is set.
+ */
+void MuscleGeometryTable::setCoordinateValues(const Model& model,
+        SimTK::State& s, const std::vector<int>& coordinates,
+        const std::vector<double>& values) const
+{
+    for (int j = 0; j < (int)coordinates.size(); ++j)
+        model.getCoordinateSet().get(_ranges[coordinates[j]].name)
+            .setValue(s, values[j], j + 1 == (int)coordinates.size());
+    if (coordinates.empty())
+        model.getMultibodySystem().realize(s, SimTK::Stage::Position);
+}
+
+int MuscleGeometryTable::getCoordinateIndex(const std::string& name) const
+{
+    for (int c = 0; c < (int)_ranges.size(); ++c)
+        if (_ranges[c].name == name) return c;
+    return -1;
+}
+
+const std::string& MuscleGeometryTable::getMuscleName(int muscle) const
+{
+    return _muscles.at(muscle).name;
+}
+
+int MuscleGeometryTable::getMuscleIndex(const std::string& name) const
+{
+    const auto it = _muscleIndices.find(name);
+    return it == _muscleIndices.end() ? -1 : it->second;
+}
+
+const std::vector<int>&
+MuscleGeometryTable::getSpannedCoordinates(int muscle) const
+{
+    return _muscles.at(muscle).coordinates;
+}
+
+std::vector<double> MuscleGeometryTable::getCoordinateValues(
+        const Model& model, const SimTK::State& s) const
+{
+    std::vector<double> q(_ranges.size());
+    for (int c = 0; c < (int)_ranges.size(); ++c)
+        q[c] = model.getCoordinateSet().get(_ranges[c].name).getValue(s);
+    return q;
+}
+
+//=============================================================================
+// INTERPOLATION
+//=============================================================================
+double MuscleGeometryTable::calcLength(int muscle,
+        const std::vector<double>& q) const
+{
+    const MuscleTable& table = _muscles.at(muscle);
+    return interpolate(table, table.lengths, q);
+}
+
+double MuscleGeometryTable::calcMomentArm(int muscle, int coordinate,
+        const std::vector<double>& q) const
+{
+    const MuscleTable& table = _muscles.at(muscle);
+    const auto it = std::find(table.coordinates.begin(),
+                              table.coordinates.end(), coordinate);
+    if (it == table.coordinates.end()) return 0;
+    return interpolate(table, table.momentArms[it - table.coordinates.begin()],
+                       q);
+}
+
+//_____________________________________________________________________________
+/**
+ * Interpolate linearly in each spanned coordinate, i.e., sum the values at
+ * the corners of the grid cell that contains q, weighted by the volume of
+ * the opposite sub-cell.
+ */
+double MuscleGeometryTable::interpolate(const MuscleTable& table,
+        const std::vector<double>& values, const std::vector<double>& q) const
+{
+    OPENSIM_THROW_IF(q.size() != _ranges.size(), Exception,
+            "Expected " + std::to_string(_ranges.size()) +
+            " coordinate values, but got " + std::to_string(q.size()) + ".");
+
+    const int numCoordinates = (int)table.coordinates.size();
+    std::vector<int> cell(numCoordinates), stride(numCoordinates);
+    std::vector<double> weight(numCoordinates);
+    int size = 1;
+    for (int j = 0; j < numCoordinates; ++j) {
+        const CoordinateRange& range = _ranges[table.coordinates[j]];
+        const double x = SimTK::clamp(0.0,
+                (q[table.coordinates[j]] - range.min) * (range.numPoints - 1)
+                    / (range.max - range.min),
+                range.numPoints - 1.0);
+        cell[j] = std::min((int)x, range.numPoints - 2);
+        weight[j] = x - cell[j];
+        stride[j] = size;
+        size *= range.numPoints;
+    }
+
+    double value = 0;
+    for (int corner = 0; corner < (1 << numCoordinates); ++corner) {
+        double w = 1;
+        int index = 0;
+        for (int j = 0; j < numCoordinates; ++j) {
+            const int upper = (corner >> j) & 1;
+            w *= upper ? weight[j] : 1 - weight[j];
+            index += (cell[j] + upper) * stride[j];
+        }
+        value += w * values[index];
+    }
+    return value;
+}
+
+//=============================================================================
+// ERRORS
+//=============================================================================
+//_____________________________________________________________________________
+/**
+ * The table is evaluated at the coordinate values of the posed model, which
+ * may differ from the sampled ones if the model has constraints.
+ */
+std::vector<MuscleGeometryTable::Errors> MuscleGeometryTable::calcErrors(
+        const Model& model, int numSamples, unsigned seed) const
+{
+    std::vector<Errors> errors(_muscles.size());
+    for (int k = 0; k < (int)_muscles.size(); ++k)
+        errors[k].muscle = _muscles[k].name;
+    if (numSamples <= 0) return errors;
+
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<double> fraction(0.0, 1.0);
+    const int numCoordinates = (int)_ranges.size();
+    std::vector<int> coordinates(numCoordinates);
+    for (int c = 0; c < numCoordinates; ++c) coordinates[c] = c;
+
+    SimTK::State s = model.getWorkingState();
+    std::vector<double> values(numCoordinates);
+    for (int i = 0; i < numSamples; ++i) {
+        for (int c = 0; c < numCoordinates; ++c)
+            values[c] = _ranges[c].min +
+                    fraction(generator) * (_ranges[c].max - _ranges[c].min);
+        setCoordinateValues(model, s, coordinates, values);
+        const std::vector<double> q = getCoordinateValues(model, s);
+
+        for (int k = 0; k < (int)_muscles.size(); ++k) {
+            const GeometryPath& path =
+                    model.getMuscles().get(_muscles[k].name).getGeometryPath();
+            const double lengthError =
+                    std::abs(calcLength(k, q) - path.getLength(s));
+            errors[k].maxLengthError =
+                    std::max(errors[k].maxLengthError, lengthError);
+            errors[k].rmsLengthError += lengthError * lengthError;
+
+            for (int c = 0; c < numCoordinates; ++c) {
+                const double momentArmError = std::abs(calcMomentArm(k, c, q)
+                    - path.computeMomentArm(s,
+                            model.getCoordinateSet().get(_ranges[c].name)));
+                errors[k].maxMomentArmError =
+                        std::max(errors[k].maxMomentArmError, momentArmError);
+                errors[k].rmsMomentArmError += momentArmError * momentArmError;
+            }
+        }
+    }
+
+    for (auto& e : errors) {
+        e.rmsLengthError = std::sqrt(e.rmsLengthError / numSamples);
+        if (numCoordinates > 0)
+            e.rmsMomentArmError = std::sqrt(
+                    e.rmsMomentArmError / (numSamples * numCoordinates));
+    }
+    return errors;
+}
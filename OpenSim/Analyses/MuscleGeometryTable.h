@@ -0,0 +1,158 @@
+#ifndef OPENSIM_MUSCLE_GEOMETRY_TABLE_H_
+#define OPENSIM_MUSCLE_GEOMETRY_TABLE_H_
+/* -------------------------------------------------------------------------- *
+ *                    OpenSim:  MuscleGeometryTable.h                         *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2019 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include <map>
+#include <string>
+#include <vector>
+
+// Header to define analysis (DLL) interface
+#include "osimAnalysesDLL.h"
+
+namespace SimTK {
+class State;
+}
+
+namespace OpenSim {
+
+class Model;
+
+/** A MuscleGeometryTable tabulates the lengths and moment arms of the
+muscles of a model over ranges of its coordinates, so that they can be
+interpolated for many frames (e.g., for many recorded trials) instead of
+being computed from the path geometry of each frame.
+
+Each muscle is tabulated on a grid over only the coordinates it spans, i.e.,
+the coordinates of the table whose values change its length. The grid has
+CoordinateRange::numPoints equally spaced values of each of these
+coordinates, and the lengths and moment arms are interpolated linearly in
+each coordinate between the grid points. Values outside of the ranges are
+clamped to them. The moment arm of a muscle about a coordinate that it does
+not span is zero. The coordinates that are not in the table keep the values
+of the model's working state while tabulating.
+
+The table is only an approximation; calcErrors() compares it to the exact
+lengths and moment arms of the model so that the number of grid points can
+be chosen for the accuracy needed. Once built, a table is not modified and
+may be used by several threads at once.
+
+@code
+MuscleGeometryTable table(model, {{"r_shoulder_elev", -1.5, 3.1, 15},
+                                   {"r_elbow_flex", 0, 2.3, 15}});
+for (const auto& errors : table.calcErrors(model, 200))
+    std::cout << errors.muscle << ": " << errors.maxLengthError << std::endl;
+double length = table.calcLength(table.getMuscleIndex("BIClong"),
+                                 table.getCoordinateValues(model, state));
+@endcode
+
+@see MuscleAnalysis::setGeometryTable() */
+class OSIMANALYSES_API MuscleGeometryTable {
+public:
+    /** A coordinate of the table and the values at which it is sampled. */
+    struct CoordinateRange {
+        std::string name;
+        double min;
+        double max;
+        int numPoints;
+    };
+
+    /** The errors of the table for one muscle, over the samples of
+    calcErrors(). The moment arm errors are over all the coordinates of the
+    table. */
+    struct Errors {
+        std::string muscle;
+        double maxLengthError = 0;
+        double rmsLengthError = 0;
+        double maxMomentArmError = 0;
+        double rmsMomentArmError = 0;
+    };
+
+    /** Tabulate the muscles named in `muscles`, or all the muscles of the
+    model if it is empty, over the given coordinate ranges. The System of
+    `model` must have been initialized; its working state is not modified. */
+    MuscleGeometryTable(const Model& model,
+            const std::vector<CoordinateRange>& ranges,
+            const std::vector<std::string>& muscles = {});
+
+    const std::vector<CoordinateRange>& getCoordinateRanges() const
+    {   return _ranges; }
+    /** The index of the named coordinate in getCoordinateRanges(), or -1 if
+    the coordinate is not in the table. */
+    int getCoordinateIndex(const std::string& name) const;
+
+    int getNumMuscles() const { return (int)_muscles.size(); }
+    const std::string& getMuscleName(int muscle) const;
+    /** The index of the named muscle, or -1 if it is not in the table. */
+    int getMuscleIndex(const std::string& name) const;
+    /** The indices in getCoordinateRanges() of the coordinates that the
+    muscle spans. */
+    const std::vector<int>& getSpannedCoordinates(int muscle) const;
+
+    /** The values of the coordinates of the table in `s`, in the order of
+    getCoordinateRanges(). */
+    std::vector<double> getCoordinateValues(const Model& model,
+            const SimTK::State& s) const;
+
+    /** Interpolate the length of a muscle at the coordinate values `q`,
+    given in the order of getCoordinateRanges(). */
+    double calcLength(int muscle, const std::vector<double>& q) const;
+    /** Interpolate the moment arm of a muscle about the coordinate with
+    index `coordinate` in getCoordinateRanges(). */
+    double calcMomentArm(int muscle, int coordinate,
+            const std::vector<double>& q) const;
+
+    /** Compare the table with the lengths and moment arms computed by
+    `model` at `numSamples` random values of the coordinates, uniformly
+    distributed over their ranges. Returns the errors of each muscle, in the
+    order of the muscles of the table. */
+    std::vector<Errors> calcErrors(const Model& model, int numSamples,
+            unsigned seed = 0) const;
+
+private:
+    struct MuscleTable {
+        std::string name;
+        // Indices of the spanned coordinates in _ranges.
+        std::vector<int> coordinates;
+        // Values at the grid points, with the first coordinate varying
+        // fastest.
+        std::vector<double> lengths;
+        std::vector<std::vector<double>> momentArms;
+    };
+
+    std::vector<std::vector<int>> findSpannedCoordinates(const Model& model,
+            const std::vector<int>& muscles) const;
+    void setCoordinateValues(const Model& model, SimTK::State& s,
+            const std::vector<int>& coordinates,
+            const std::vector<double>& values) const;
+    double interpolate(const MuscleTable& table,
+            const std::vector<double>& values,
+            const std::vector<double>& q) const;
+
+    std::vector<CoordinateRange> _ranges;
+    std::vector<MuscleTable> _muscles;
+    std::map<std::string, int> _muscleIndices;
+};
+
+} // namespace OpenSim
+
+#endif // OPENSIM_MUSCLE_GEOMETRY_TABLE_H_
@@ -218,6 +218,8 @@ allocateStorage()
     _activationStorage->setDescription(getDescription());
     _activationStorage->setColumnLabels(getColumnLabels());
 
+    _storageList.setSize(0);
+    _storageList.append(_activationStorage);
 }
 
 
@@ -596,6 +598,7 @@ int StaticOptimization::begin(const SimTK::State& s )
     // RESET STORAGE
     _activationStorage->reset(s.getTime());
     _forceReporter->updForceStorage().reset(s.getTime());
+    _storageList.append(&_forceReporter->updForceStorage());
 
     // RECORD
     int status = 0;
@@ -0,0 +1,178 @@
+/* -------------------------------------------------------------------------- *
+ *                  OpenSim:  testMuscleGeometryTable.cpp                     *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2019 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include <OpenSim/Common/osimCommon.h>
+#include <OpenSim/Simulation/osimSimulation.h>
+#include <OpenSim/Actuators/osimActuators.h>
+#include <OpenSim/Auxiliary/auxiliaryTestFunctions.h>
+#include <OpenSim/Analyses/MuscleAnalysis.h>
+#include <OpenSim/Analyses/MuscleGeometryTable.h>
+
+using namespace OpenSim;
+using namespace SimTK;
+using namespace std;
+
+void testTable();
+void testMuscleAnalysisWithTable();
+
+int main()
+{
+    SimTK::Array_<std::string> failures;
+
+    try { testTable(); }
+    catch (const std::exception& e) {
+        cout << e.what() << endl; failures.push_back("testTable");
+    }
+    try { testMuscleAnalysisWithTable(); }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testMuscleAnalysisWithTable");
+    }
+
+    if (!failures.empty()) {
+        cout << "Done, with failure(s): " << failures << endl;
+        return 1;
+    }
+
+    cout << "Done" << endl;
+    return 0;
+}
+
+// A planar arm with a shoulder and an elbow, a muscle spanning both joints
+// and a muscle spanning only the elbow.
+Model createArm()
+{
+    Model model;
+    model.setName("arm");
+    auto* upper = new OpenSim::Body("upper", 1, Vec3(0, -0.15, 0),
+                                    Inertia(0.01));
+    auto* lower = new OpenSim::Body("lower", 1, Vec3(0, -0.15, 0),
+                                    Inertia(0.01));
+    model.addBody(upper);
+    model.addBody(lower);
+    model.addJoint(new PinJoint("shoulder", model.getGround(), Vec3(0),
+                                Vec3(0), *upper, Vec3(0), Vec3(0)));
+    model.addJoint(new PinJoint("elbow", *upper, Vec3(0, -0.3, 0), Vec3(0),
+                                *lower, Vec3(0), Vec3(0)));
+
+    auto* biarticular = new Thelen2003Muscle("biarticular", 100, 0.2, 0.2, 0);
+    biarticular->addNewPathPoint("origin", model.updGround(),
+                                 Vec3(0.03, 0.02, 0));
+    biarticular->addNewPathPoint("via", *upper, Vec3(0.03, -0.2, 0));
+    biarticular->addNewPathPoint("insertion", *lower, Vec3(0.02, -0.05, 0));
+    model.addForce(biarticular);
+
+    auto* elbowMuscle = new Thelen2003Muscle("elbowMuscle", 100, 0.1, 0.1, 0);
+    elbowMuscle->addNewPathPoint("origin", *upper, Vec3(-0.02, -0.1, 0));
+    elbowMuscle->addNewPathPoint("insertion", *lower, Vec3(-0.02, -0.04, 0));
+    model.addForce(elbowMuscle);
+    return model;
+}
+
+void testTable()
+{
+    Model model = createArm();
+    model.initSystem();
+    const std::vector<MuscleGeometryTable::CoordinateRange> ranges = {
+        {"shoulder_coord_0", -1.0, 1.0, 11}, {"elbow_coord_0", 0.0, 2.0, 11}};
+    const MuscleGeometryTable table(model, ranges);
+
+    ASSERT(table.getNumMuscles() == 2);
+    const int bi = table.getMuscleIndex("biarticular");
+    const int mono = table.getMuscleIndex("elbowMuscle");
+    ASSERT(table.getSpannedCoordinates(bi) == std::vector<int>({0, 1}));
+    ASSERT(table.getSpannedCoordinates(mono) == std::vector<int>({1}));
+    ASSERT(table.getMuscleIndex("notAMuscle") == -1);
+
+    // The table is exact at the grid points.
+    State s = model.getWorkingState();
+    const auto& shoulder = model.getCoordinateSet().get("shoulder_coord_0");
+    const auto& elbow = model.getCoordinateSet().get("elbow_coord_0");
+    const auto& muscle = model.getMuscles().get("biarticular");
+    shoulder.setValue(s, 0.4, false);
+    elbow.setValue(s, 1.2);
+    const std::vector<double> q = table.getCoordinateValues(model, s);
+    ASSERT_EQUAL(muscle.getLength(s), table.calcLength(bi, q), 1e-12);
+    ASSERT_EQUAL(muscle.getGeometryPath().computeMomentArm(s, elbow),
+                 table.calcMomentArm(bi, 1, q), 1e-10);
+    ASSERT_EQUAL(0.0, table.calcMomentArm(mono, 0, q), 0.0);
+
+    // The errors shrink as the grid is refined.
+    const auto errors = table.calcErrors(model, 50);
+    std::vector<MuscleGeometryTable::CoordinateRange> fineRanges = ranges;
+    for (auto& range : fineRanges) range.numPoints = 41;
+    const auto fineErrors =
+            MuscleGeometryTable(model, fineRanges).calcErrors(model, 50);
+    for (int k = 0; k < table.getNumMuscles(); ++k) {
+        ASSERT(errors[k].muscle == table.getMuscleName(k));
+        ASSERT(errors[k].maxLengthError < 1e-3);
+        ASSERT(errors[k].rmsLengthError <= errors[k].maxLengthError);
+        ASSERT(fineErrors[k].maxLengthError < errors[k].maxLengthError);
+        ASSERT(fineErrors[k].maxMomentArmError < errors[k].maxMomentArmError);
+    }
+
+    const std::vector<MuscleGeometryTable::CoordinateRange> badRanges = {
+        {"notACoordinate", 0.0, 1.0, 3}};
+    ASSERT_THROW(OpenSim::Exception, MuscleGeometryTable(model, badRanges));
+}
+
+void testMuscleAnalysisWithTable()
+{
+    Model model = createArm();
+    State& s = model.initSystem();
+    model.getCoordinateSet().get("shoulder_coord_0").setValue(s, 0.3);
+    model.getCoordinateSet().get("elbow_coord_0").setValue(s, 0.9);
+    model.realizeDynamics(s);
+
+    auto table = std::make_shared<MuscleGeometryTable>(model,
+        std::vector<MuscleGeometryTable::CoordinateRange>{
+            {"shoulder_coord_0", -1.0, 1.0, 21},
+            {"elbow_coord_0", 0.0, 2.0, 21}});
+
+    MuscleAnalysis exact(&model);
+    exact.begin(s);
+    MuscleAnalysis tabulated(&model);
+    tabulated.setGeometryTable(table);
+    tabulated.begin(s);
+
+    const Array<double>& exactLengths = exact.getMuscleTendonLengthStorage()
+            ->getStateVector(0)->getData();
+    const Array<double>& lengths = tabulated.getMuscleTendonLengthStorage()
+            ->getStateVector(0)->getData();
+    // The lengths are still computed from the model, so that each row is
+    // consistent with the tendon and fiber lengths.
+    ASSERT(lengths.getSize() == 2);
+    for (int i = 0; i < lengths.getSize(); ++i)
+        ASSERT_EQUAL(exactLengths[i], lengths[i], 1e-12);
+
+    const auto& exactMomentArms = exact.getMomentArmStorageArray();
+    const auto& momentArms = tabulated.getMomentArmStorageArray();
+    ASSERT(momentArms.getSize() == 2);
+    for (int c = 0; c < momentArms.getSize(); ++c) {
+        const Array<double>& expected = exactMomentArms[c]->momentArmStore
+                ->getStateVector(0)->getData();
+        const Array<double>& actual = momentArms[c]->momentArmStore
+                ->getStateVector(0)->getData();
+        for (int i = 0; i < actual.getSize(); ++i)
+            ASSERT_EQUAL(expected[i], actual[i], 1e-3);
+    }
+}
@@ -30,6 +30,7 @@
 #include "PointKinematics.h"
 #include "BodyKinematics.h"
 #include "MuscleAnalysis.h"
+#include "MuscleGeometryTable.h"
 #include "JointReaction.h"
 #include "StaticOptimization.h"
 #include "StatesReporter.h"
@@ -2,6 +2,7 @@
 #include "Simbody.h"
 #include "Exception.h"
 #include "FileAdapter.h"
+#include "IO.h"
 #include "TimeSeriesTable.h"
 #include "APDMDataReader.h"
 
@@ -32,7 +33,7 @@ APDMDataReader::extendRead(const std::string& fileName) const {
     OPENSIM_THROW_IF(fileName.empty(),
         EmptyFileName);
 
-    std::ifstream in_stream{ fileName };
+    std::ifstream in_stream{ IO::resolvePath(fileName) };
     OPENSIM_THROW_IF(!in_stream.good(),
         FileDoesNotExist,
         fileName);
@@ -1,4 +1,5 @@
 #include "C3DFileAdapter.h"
+#include "IO.h"
 
 #include "btkAcquisitionFileReader.h"
 #include "btkAcquisition.h"
@@ -69,7 +70,7 @@ C3DFileAdapter::write(const C3DFileAdapter::Tables& tables,
 C3DFileAdapter::OutputTables
 C3DFileAdapter::extendRead(const std::string& fileName) const {
     auto reader = btk::AcquisitionFileReader::New();
-    reader->SetFilename(fileName);
+    reader->SetFilename(IO::resolvePath(fileName));
     reader->Update();
     auto acquisition = reader->GetOutput();
 
@@ -24,6 +24,7 @@
 
 // INCLUDES
 #include "Component.h"
+#include "ComponentProfiler.h"
 #include "OpenSim/Common/IO.h"
 #include "XMLDocument.h"
 #include <unordered_map>
@@ -79,29 +80,38 @@ public:
     {   return this->getValueZero(); }
 
     void realizeMeasureTopologyVirtual(SimTK::State& s) const override final
-    {   _Component.extendRealizeTopology(s); }
+    {   ComponentProfiler::Scope scope(_Component, "realizeTopology");
+        _Component.extendRealizeTopology(s); }
     void realizeMeasureModelVirtual(SimTK::State& s) const override final
-    {   _Component.extendRealizeModel(s); }
+    {   ComponentProfiler::Scope scope(_Component, "realizeModel");
+        _Component.extendRealizeModel(s); }
     void realizeMeasureInstanceVirtual(const SimTK::State& s)
         const override final
-    {   _Component.extendRealizeInstance(s); }
+    {   ComponentProfiler::Scope scope(_Component, "realizeInstance");
+        _Component.extendRealizeInstance(s); }
     void realizeMeasureTimeVirtual(const SimTK::State& s) const override final
-    {   _Component.extendRealizeTime(s); }
+    {   ComponentProfiler::Scope scope(_Component, "realizeTime");
+        _Component.extendRealizeTime(s); }
     void realizeMeasurePositionVirtual(const SimTK::State& s)
         const override final
-    {   _Component.extendRealizePosition(s); }
+    {   ComponentProfiler::Scope scope(_Component, "realizePosition");
+        _Component.extendRealizePosition(s); }
     void realizeMeasureVelocityVirtual(const SimTK::State& s)
         const override final
-    {   _Component.extendRealizeVelocity(s); }
+    {   ComponentProfiler::Scope scope(_Component, "realizeVelocity");
+        _Component.extendRealizeVelocity(s); }
     void realizeMeasureDynamicsVirtual(const SimTK::State& s)
         const override final
-    {   _Component.extendRealizeDynamics(s); }
+    {   ComponentProfiler::Scope scope(_Component, "realizeDynamics");
+        _Component.extendRealizeDynamics(s); }
     void realizeMeasureAccelerationVirtual(const SimTK::State& s)
         const override final
-    {   _Component.extendRealizeAcceleration(s); }
+    {   ComponentProfiler::Scope scope(_Component, "realizeAcceleration");
+        _Component.extendRealizeAcceleration(s); }
     void realizeMeasureReportVirtual(const SimTK::State& s)
         const override final
-    {   _Component.extendRealizeReport(s); }
+    {   ComponentProfiler::Scope scope(_Component, "realizeReport");
+        _Component.extendRealizeReport(s); }
 
 private:
     const Component& _Component;
@@ -865,6 +875,15 @@ double Component::
     return SimTK::NaN;
 }
 
+// Residual of the explicit form of the dynamics of a state variable.
+double Component::
+    calcStateVariableImplicitResidual(const SimTK::State& state,
+                                      const std::string& name,
+                                      double derivative) const
+{
+    return derivative - getStateVariableDerivativeValue(state, name);
+}
+
 // Set the value of a state variable allocated by this Component given its name
 // for this component.
 void Component::
@@ -1342,6 +1342,37 @@ public:
     double getStateVariableDerivativeValue(const SimTK::State& state, 
         const std::string& name) const;
 
+    /**
+     * Whether this Component provides an implicit form, f(y, ydot) = 0, of
+     * the dynamics of a state variable it added. Components that override
+     * this method must also override calcStateVariableImplicitResidual().
+     *
+     * @param name    the name (string) of a state variable added by this
+     *                Component
+     */
+    virtual bool hasImplicitForm(const std::string& name) const
+    {   return false; }
+
+    /**
+     * Calculate the residual of the dynamics of a state variable added by this
+     * Component, given a value for the derivative of the state variable. The
+     * residual is zero when the derivative satisfies the dynamics.
+     *
+     * The default is the explicit form: the difference between `derivative`
+     * and getStateVariableDerivativeValue(). Components that have an implicit
+     * form (see hasImplicitForm()) use it instead, which avoids computing the
+     * derivative (e.g., inverting a muscle's force-velocity curve). The state
+     * must be realized to Dynamics.
+     *
+     * @param state      the State for which to compute the residual
+     * @param name       the name (string) of a state variable added by this
+     *                   Component
+     * @param derivative the value of the derivative of the state variable
+     * @see Model::calcImplicitResidual()
+     */
+    virtual double calcStateVariableImplicitResidual(const SimTK::State& state,
+        const std::string& name, double derivative) const;
+
     /**
      * Get the value of a discrete variable allocated by this Component by name.
      *
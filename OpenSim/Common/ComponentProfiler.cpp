@@ -0,0 +1,261 @@
+/* -------------------------------------------------------------------------- *
+ *                      OpenSim:  ComponentProfiler.cpp                       *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2019 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "ComponentProfiler.h"
+#include "Component.h"
+#include "Exception.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <mutex>
+
+using namespace OpenSim;
+
+std::atomic<bool> ComponentProfiler::_enabled{false};
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    struct Entry {
+        std::string path;
+        std::string type;
+        std::string computation;
+        long long numCalls = 0;
+        double totalTime = 0;
+        double selfTime = 0;
+        double maxTime = 0;
+    };
+
+    struct Event {
+        size_t entry;
+        int thread;
+        double start; // microseconds since the profiler's epoch
+        double duration;
+    };
+
+    // All profiler data is guarded by one mutex; it is only touched when
+    // the profiler is enabled.
+    struct ProfilerData {
+        std::mutex mutex;
+        std::map<std::pair<const Object*, const char*>, size_t> index;
+        std::vector<Entry> entries;
+        bool tracing = false;
+        size_t maxEvents = 0;
+        std::vector<Event> events;
+        Clock::time_point epoch = Clock::now();
+        int numThreads = 0;
+    };
+
+    ProfilerData& getData() {
+        static ProfilerData data;
+        return data;
+    }
+
+    // The innermost open Scope on this thread, and a small id per thread for
+    // the trace events.
+    thread_local ComponentProfiler::Scope* currentScope = nullptr;
+    thread_local int threadId = -1;
+
+    std::string getPathOf(const Object& object) {
+        if (const auto* component = dynamic_cast<const Component*>(&object)) {
+            // A component that is not part of a tree has no absolute path.
+            try { return component->getAbsolutePathString(); }
+            catch (const Exception&) {}
+        }
+        return object.getName();
+    }
+}
+
+//=============================================================================
+// SCOPE
+//=============================================================================
+void ComponentProfiler::Scope::begin(const Object& object,
+                                     const char* computation) {
+    _object = &object;
+    _computation = computation;
+    _parent = currentScope;
+    currentScope = this;
+    _start = Clock::now();
+}
+
+void ComponentProfiler::Scope::end() {
+    const Clock::time_point stop = Clock::now();
+    const double elapsed = std::chrono::duration<double>(stop - _start).count();
+    currentScope = _parent;
+    if (_parent) _parent->_childTime += elapsed;
+
+    ProfilerData& data = getData();
+    std::lock_guard<std::mutex> lock(data.mutex);
+
+    const auto key = std::make_pair(_object, _computation);
+    auto it = data.index.find(key);
+    if (it == data.index.end()) {
+        Entry entry;
+        entry.path = getPathOf(*_object);
+        entry.type = _object->getConcreteClassName();
+        entry.computation = _computation;
+        it = data.index.emplace(key, data.entries.size()).first;
+        data.entries.push_back(std::move(entry));
+    }
+    Entry& entry = data.entries[it->second];
+    ++entry.numCalls;
+    entry.totalTime += elapsed;
+    entry.selfTime += elapsed - _childTime;
+    entry.maxTime = std::max(entry.maxTime, elapsed);
+
+    if (data.tracing && data.events.size() < data.maxEvents) {
+        if (threadId < 0) threadId = data.numThreads++;
+        using micro = std::chrono::duration<double, std::micro>;
+        data.events.push_back({it->second, threadId,
+                micro(_start - data.epoch).count(), elapsed * 1e6});
+    }
+}
+
+//=============================================================================
+// PROFILER
+//=============================================================================
+void ComponentProfiler::setTracingEnabled(bool tracing, size_t maxEvents) {
+    ProfilerData& data = getData();
+    std::lock_guard<std::mutex> lock(data.mutex);
+    data.tracing = tracing;
+    data.maxEvents = maxEvents;
+}
+
+bool ComponentProfiler::isTracingEnabled() {
+    ProfilerData& data = getData();
+    std::lock_guard<std::mutex> lock(data.mutex);
+    return data.tracing;
+}
+
+void ComponentProfiler::reset() {
+    ProfilerData& data = getData();
+    std::lock_guard<std::mutex> lock(data.mutex);
+    data.index.clear();
+    data.entries.clear();
+    data.events.clear();
+    data.epoch = Clock::now();
+}
+
+std::vector<ComponentProfiler::Record>
+ComponentProfiler::getRecords(Grouping grouping) {
+    ProfilerData& data = getData();
+    std::lock_guard<std::mutex> lock(data.mutex);
+
+    // Entries of distinct objects may share a path (or type), and the same
+    // computation name may have been passed from distinct string literals.
+    std::map<std::pair<std::string, std::string>, Record> grouped;
+    for (const Entry& entry : data.entries) {
+        const std::string& group =
+                grouping == ByType ? entry.type : entry.path;
+        Record& record = grouped[{group, entry.computation}];
+        if (record.numCalls == 0) {
+            record.path = grouping == ByType ? "" : entry.path;
+            record.type = entry.type;
+            record.computation = entry.computation;
+        }
+        record.numCalls += entry.numCalls;
+        record.totalTime += entry.totalTime;
+        record.selfTime += entry.selfTime;
+        record.maxTime = std::max(record.maxTime, entry.maxTime);
+    }
+
+    std::vector<Record> records;
+    for (auto& it : grouped) records.push_back(std::move(it.second));
+    std::sort(records.begin(), records.end(),
+            [](const Record& a, const Record& b) {
+                return a.selfTime > b.selfTime;
+            });
+    return records;
+}
+
+void ComponentProfiler::printTable(std::ostream& out, Grouping grouping) {
+    const std::vector<Record> records = getRecords(grouping);
+
+    double totalSelfTime = 0;
+    for (const Record& record : records) totalSelfTime += record.selfTime;
+
+    const std::ios::fmtflags flags = out.flags();
+    out << std::left << std::setw(48)
+        << (grouping == ByType ? "type" : "component")
+        << std::setw(28) << "computation"
+        << std::right << std::setw(12) << "calls"
+        << std::setw(14) << "total (ms)" << std::setw(14) << "self (ms)"
+        << std::setw(10) << "self %" << std::setw(14) << "mean (us)"
+        << std::setw(14) << "max (us)" << "\n";
+    for (const Record& record : records) {
+        out << std::left << std::setw(48)
+            << (grouping == ByType ? record.type : record.path)
+            << std::setw(28) << record.computation
+            << std::right << std::setw(12) << record.numCalls
+            << std::fixed << std::setprecision(3)
+            << std::setw(14) << 1e3 * record.totalTime
+            << std::setw(14) << 1e3 * record.selfTime
+            << std::setprecision(1) << std::setw(10)
+            << (totalSelfTime > 0 ? 100 * record.selfTime / totalSelfTime : 0)
+            << std::setprecision(3) << std::setw(14)
+            << 1e6 * record.totalTime / record.numCalls
+            << std::setw(14) << 1e6 * record.maxTime << "\n";
+        out.flags(flags);
+    }
+    out.flush();
+}
+
+void ComponentProfiler::printChromeTrace(std::ostream& out) {
+    ProfilerData& data = getData();
+    std::lock_guard<std::mutex> lock(data.mutex);
+
+    // Names are component paths and computation names; escape anything
+    // that JSON does not allow in a string.
+    auto escape = [](const std::string& s) {
+        std::string escaped;
+        for (char c : s) {
+            if (c == '"' || c == '\\') escaped += '\\';
+            if (static_cast<unsigned char>(c) >= 0x20) escaped += c;
+        }
+        return escaped;
+    };
+
+    const std::ios::fmtflags flags = out.flags();
+    out << "{\"traceEvents\":[";
+    out << std::fixed << std::setprecision(3);
+    for (size_t i = 0; i < data.events.size(); ++i) {
+        const Event& event = data.events[i];
+        const Entry& entry = data.entries[event.entry];
+        if (i > 0) out << ",";
+        out << "\n{\"name\":\"" << escape(entry.computation)
+            << "\",\"cat\":\"" << escape(entry.type)
+            << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << event.thread
+            << ",\"ts\":" << event.start << ",\"dur\":" << event.duration
+            << ",\"args\":{\"path\":\"" << escape(entry.path) << "\"}}";
+    }
+    out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    out.flags(flags);
+}
+
+void ComponentProfiler::printChromeTrace(const std::string& fileName) {
+    std::ofstream out(fileName);
+    OPENSIM_THROW_IF(!out.good(), Exception,
+            "Could not open file '" + fileName + "' for writing.");
+    printChromeTrace(out);
+}
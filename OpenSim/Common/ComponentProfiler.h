@@ -0,0 +1,148 @@
+#ifndef OPENSIM_COMPONENT_PROFILER_H_
+#define OPENSIM_COMPONENT_PROFILER_H_
+/* -------------------------------------------------------------------------- *
+ *                       OpenSim:  ComponentProfiler.h                        *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2019 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "osimCommonDLL.h"
+
+#include <atomic>
+#include <chrono>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace OpenSim {
+
+class Object;
+
+//=============================================================================
+//=============================================================================
+/**
+ * An opt-in, process-wide profiler for the computations performed by
+ * Components (and other Objects, such as Analyses) during a simulation.
+ *
+ * Instrumented computations (Component realizations at each stage,
+ * Force::computeForce(), Muscle::calcMuscleDynamicsInfo(),
+ * GeometryPath::computePath(), Controller::computeControls() and
+ * Analysis::step()) open a ComponentProfiler::Scope for the duration of the
+ * call. When the profiler is disabled (the default), a Scope costs a single
+ * relaxed atomic load. When enabled, each Scope records its call count,
+ * inclusive wall time and self time (its wall time less that of the Scopes
+ * nested inside it on the same thread), keyed by the object and the name of
+ * the computation.
+ *
+ * Results can be aggregated by the absolute path of each component or by its
+ * concrete class name, and printed as a table. If tracing is also enabled,
+ * every Scope is kept as an event that can be written in the Chrome trace
+ * event format (viewable at chrome://tracing or https://ui.perfetto.dev).
+ *
+ * @code
+ * ComponentProfiler::setEnabled(true);
+ * manager.integrate(finalTime);
+ * ComponentProfiler::setEnabled(false);
+ * ComponentProfiler::printTable(std::cout, ComponentProfiler::ByType);
+ * @endcode
+ *
+ * Entries are keyed by the address of the profiled object, so call reset()
+ * before profiling a new model if the old one has been destroyed.
+ */
+class OSIMCOMMON_API ComponentProfiler {
+public:
+    /// How to aggregate entries in getRecords() and printTable().
+    enum Grouping {
+        /// One record per component (absolute path) and computation.
+        ByPath,
+        /// One record per concrete class name and computation.
+        ByType
+    };
+
+    /// Statistics for one computation of one component (or type).
+    struct Record {
+        std::string path;
+        std::string type;
+        std::string computation;
+        long long   numCalls = 0;
+        /// Total wall time (s), including nested computations.
+        double      totalTime = 0;
+        /// Wall time (s) excluding nested computations.
+        double      selfTime = 0;
+        /// Longest single call (s).
+        double      maxTime = 0;
+    };
+
+    /** Time the computation named `computation` (which must be a string
+     * literal or otherwise outlive the profiler's records) performed by
+     * `object`, from construction to destruction of the Scope. */
+    class OSIMCOMMON_API Scope {
+    public:
+        Scope(const Object& object, const char* computation) {
+            if (isEnabled()) begin(object, computation);
+        }
+        ~Scope() { if (_object) end(); }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    private:
+        void begin(const Object& object, const char* computation);
+        void end();
+
+        const Object* _object = nullptr;
+        const char*   _computation = nullptr;
+        Scope*        _parent = nullptr;
+        double        _childTime = 0;
+        std::chrono::steady_clock::time_point _start;
+    };
+
+    /// Turn recording on or off. Recording is off by default.
+    static void setEnabled(bool enabled) {
+        _enabled.store(enabled, std::memory_order_relaxed);
+    }
+    static bool isEnabled() {
+        return _enabled.load(std::memory_order_relaxed);
+    }
+
+    /** Also keep each call as a trace event for printChromeTrace(). At most
+     * `maxEvents` events are kept; later events are dropped. Tracing only
+     * records while the profiler is enabled. */
+    static void setTracingEnabled(bool tracing, size_t maxEvents = 1000000);
+    static bool isTracingEnabled();
+
+    /// Discard all records and trace events.
+    static void reset();
+
+    /// Get the recorded statistics, sorted by decreasing self time.
+    static std::vector<Record> getRecords(Grouping grouping = ByPath);
+
+    /// Print the recorded statistics as a table, sorted by self time.
+    static void printTable(std::ostream& out, Grouping grouping = ByPath);
+
+    /// Write the trace events in the Chrome trace event (JSON) format.
+    static void printChromeTrace(std::ostream& out);
+    static void printChromeTrace(const std::string& fileName);
+
+private:
+    static std::atomic<bool> _enabled;
+};
+
+} // end of namespace OpenSim
+
+#endif // OPENSIM_COMPONENT_PROFILER_H_
@@ -46,6 +46,8 @@ registerAdapters{DataAdapter::registerDataAdapter("trc", TRCFileAdapter{})
         && DataAdapter::registerDataAdapter("csv", CSVFileAdapter{})
 #ifdef WITH_BTK 
               && DataAdapter::registerDataAdapter("c3d", C3DFileAdapter{})
+#else
+              && DataAdapter::registerDataAdapter("c3d", NativeC3DFileAdapter{})
 #endif
                 };
 
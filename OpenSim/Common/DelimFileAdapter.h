@@ -310,7 +310,7 @@ DelimFileAdapter<T>::extendRead(const std::string& fileName) const {
     OPENSIM_THROW_IF(fileName.empty(),
                      EmptyFileName);
 
-    std::ifstream in_stream{fileName};
+    std::ifstream in_stream{IO::resolvePath(fileName)};
     OPENSIM_THROW_IF(!in_stream.good(),
                      FileDoesNotExist,
                      fileName);
@@ -578,7 +578,7 @@ DelimFileAdapter<T>::extendWrite(const InputTables& absTables,
     OPENSIM_THROW_IF(fileName.empty(),
                      EmptyFileName);
 
-    std::ofstream out_stream{fileName};
+    std::ofstream out_stream{IO::resolvePath(fileName)};
 
     // First line of the stream is the header.
     if (table->getTableMetaData().hasKey("header")) {
@@ -140,17 +140,17 @@ evaluate(Array<double> &rValues,int aDerivOrder,double aX) const
     int size = getSize();
     rValues.setSize(size);
 
+    // The argument and the derivative components are the same for all of
+    // the functions.
+    const SimTK::Vector arg(1, aX);
+    const std::vector<int> derivComponents(aDerivOrder > 0 ? aDerivOrder : 0, 0);
+
     int i;
     for(i=0;i<size;i++) {
         Function& func = get(i);
         if (aDerivOrder==0)
-            rValues[i] = func.calcValue(SimTK::Vector(1,aX));
-        else {
-            std::vector<int> derivComponents;
-            for(int j=0; j<aDerivOrder; j++)
-                derivComponents.push_back(0);
-            rValues[i] = func.calcDerivative(derivComponents, SimTK::Vector(1,aX));
-
-        }
+            rValues[i] = func.calcValue(arg);
+        else
+            rValues[i] = func.calcDerivative(derivComponents, arg);
     }
 }
@@ -31,6 +31,7 @@
 #include <math.h>
 #include <string>
 #include <climits>
+#include <cctype>
 
 #include "IO.h"
 #if defined(__linux__) || defined(__APPLE__)
@@ -57,13 +58,27 @@ using namespace OpenSim;
 using namespace std;
 
 // STATICS
-bool IO::_Scientific = false;
-bool IO::_GFormatForDoubleOutput = false;
-int IO::_Pad = 8;
-int IO::_Precision = 8;
-char IO::_DoubleFormat[] = "%16.8lf";
 bool IO::_PrintOfflineDocuments = true;
 
+namespace {
+// The settings that tools change while they run are kept per thread, so that
+// tools running on different threads do not see each other's settings.
+struct ThreadSettings {
+    bool scientific = false;
+    bool gFormatForDoubleOutput = false;
+    int pad = 8;
+    int precision = 8;
+    char doubleFormat[256] = "%16.8lf";
+    std::string baseDirectory;
+};
+
+ThreadSettings& threadSettings()
+{
+    static thread_local ThreadSettings settings;
+    return settings;
+}
+}
+
 
 //=============================================================================
 // FILE NAME UTILITIES
@@ -132,7 +147,7 @@ FixSlashesInFilePath(const std::string &path)
 void IO::
 SetScientific(bool aTrueFalse)
 {
-    _Scientific = aTrueFalse;
+    threadSettings().scientific = aTrueFalse;
     ConstructDoubleOutputFormat();
 }
 
@@ -146,7 +161,7 @@ SetScientific(bool aTrueFalse)
 bool IO::
 GetScientific()
 {
-    return(_Scientific);
+    return(threadSettings().scientific);
 }
 
 //-----------------------------------------------------------------------------
@@ -159,7 +174,7 @@ GetScientific()
 void IO::
 SetGFormatForDoubleOutput(bool aTrueFalse)
 {
-    _GFormatForDoubleOutput = aTrueFalse;
+    threadSettings().gFormatForDoubleOutput = aTrueFalse;
     ConstructDoubleOutputFormat();
 }
 
@@ -169,7 +184,7 @@ SetGFormatForDoubleOutput(bool aTrueFalse)
 bool IO::
 GetGFormatForDoubleOutput()
 {
-    return(_GFormatForDoubleOutput);
+    return(threadSettings().gFormatForDoubleOutput);
 }
 
 //-----------------------------------------------------------------------------
@@ -191,7 +206,7 @@ void IO::
 SetDigitsPad(int aPad)
 {
     if(aPad<0) aPad = -1;
-    _Pad = aPad;
+    threadSettings().pad = aPad;
     ConstructDoubleOutputFormat();
 }
 //_____________________________________________________________________________
@@ -209,7 +224,7 @@ SetDigitsPad(int aPad)
 int IO::
 GetDigitsPad()
 {
-    return(_Pad);
+    return(threadSettings().pad);
 }
 
 //-----------------------------------------------------------------------------
@@ -226,7 +241,7 @@ void IO::
 SetPrecision(int aPrecision)
 {
     if(aPrecision<0) aPrecision = 0;
-    _Precision = aPrecision;
+    threadSettings().precision = aPrecision;
     ConstructDoubleOutputFormat();
 }
 //_____________________________________________________________________________
@@ -239,7 +254,7 @@ SetPrecision(int aPrecision)
 int IO::
 GetPrecision()
 {
-    return(_Precision);
+    return(threadSettings().precision);
 }
 
 //-----------------------------------------------------------------------------
@@ -249,9 +264,9 @@ GetPrecision()
 /**
  * Get the current output format for numbers of type double.
  *
- * The format is maintained as a static variable in class IO, so any
- * changes made to the output parameters in class IO will be seen globally
- * by all classes using this method.
+ * The format is maintained per thread by class IO, so any changes made to
+ * the output parameters in class IO will be seen by all classes using this
+ * method on the same thread.
  *
  * The returned output format will be of the form
  *
@@ -266,7 +281,7 @@ GetPrecision()
 const char* IO::
 GetDoubleOutputFormat()
 {
-    return(_DoubleFormat);
+    return(threadSettings().doubleFormat);
 }
 
 //_____________________________________________________________________________
@@ -280,19 +295,20 @@ GetDoubleOutputFormat()
 void IO::
 ConstructDoubleOutputFormat()
 {
-    if(_GFormatForDoubleOutput) {
-        sprintf(_DoubleFormat,"%%g");
-    } else if(_Scientific) {
-        if(_Pad<0) {
-            sprintf(_DoubleFormat,"%%.%dle",_Precision);
+    ThreadSettings& settings = threadSettings();
+    if(settings.gFormatForDoubleOutput) {
+        sprintf(settings.doubleFormat,"%%g");
+    } else if(settings.scientific) {
+        if(settings.pad<0) {
+            sprintf(settings.doubleFormat,"%%.%dle",settings.precision);
         } else {
-            sprintf(_DoubleFormat,"%%%d.%dle",_Pad+_Precision,_Precision);
+            sprintf(settings.doubleFormat,"%%%d.%dle",settings.pad+settings.precision,settings.precision);
         }
     } else {
-        if(_Pad<0) {
-            sprintf(_DoubleFormat,"%%.%dlf",_Precision);
+        if(settings.pad<0) {
+            sprintf(settings.doubleFormat,"%%.%dlf",settings.precision);
         } else {
-            sprintf(_DoubleFormat,"%%%d.%dlf",_Pad+_Precision,_Precision);
+            sprintf(settings.doubleFormat,"%%%d.%dlf",settings.pad+settings.precision,settings.precision);
         }
     }
 }
@@ -419,7 +435,7 @@ ReadCharacters(istream &aIS,int aNChar)
 }
 
 bool IO::FileExists(const std::string& filePath) {
-    return std::ifstream(filePath).good();
+    return std::ifstream(resolvePath(filePath)).good();
 }
 
 //_____________________________________________________________________________
@@ -432,7 +448,7 @@ OpenFile(const string &aFileName,const string &aMode)
     FILE *fp = NULL;
 
     // OPEN THE FILE
-    fp = fopen(aFileName.c_str(),aMode.c_str());
+    fp = fopen(resolvePath(aFileName).c_str(),aMode.c_str());
     if(fp==NULL) {
         printf("IO.OpenFile(const string&,const string&): failed to open %s\n",
          aFileName.c_str());
@@ -448,7 +464,7 @@ OpenFile(const string &aFileName,const string &aMode)
 ifstream *IO::
 OpenInputFile(const string &aFileName,ios_base::openmode mode)
 {
-    ifstream *fs = new ifstream(aFileName.c_str(), ios_base::in | mode);
+    ifstream *fs = new ifstream(resolvePath(aFileName).c_str(), ios_base::in | mode);
     if(!fs || !(*fs)) {
         printf("IO.OpenInputFile(const string&,openmode mode): failed to open %s\n", aFileName.c_str());
         return(NULL);
@@ -459,7 +475,7 @@ OpenInputFile(const string &aFileName,ios_base::openmode mode)
 ofstream *IO::
 OpenOutputFile(const string &aFileName,ios_base::openmode mode)
 {
-    ofstream *fs = new ofstream(aFileName.c_str(), ios_base::out | mode);
+    ofstream *fs = new ofstream(resolvePath(aFileName).c_str(), ios_base::out | mode);
     if(!fs || !(*fs)) {
         printf("IO.OpenOutputFile(const string&,openmode mode): failed to open %s\n", aFileName.c_str());
         return(NULL);
@@ -476,10 +492,11 @@ int IO::
 makeDir(const string &aDirName)
 {
 
+    const string dirName = resolvePath(aDirName);
 #if defined __linux__ || defined __APPLE__
-    return mkdir(aDirName.c_str(),S_IRWXU);
+    return mkdir(dirName.c_str(),S_IRWXU);
 #else
-    return _mkdir(aDirName.c_str());
+    return _mkdir(dirName.c_str());
 #endif
 }
 //_____________________________________________________________________________
@@ -515,6 +532,57 @@ getCwd()
     return string(buffer);
 }
 
+//_____________________________________________________________________________
+/**
+ * Set the base directory of the calling thread. A relative directory is
+ * resolved against the current base directory, or against the working
+ * directory of the process, so that the base directory is always absolute
+ * and resolving a file name twice gives the same file.
+ */
+void IO::
+setBaseDirectory(const string& directory)
+{
+    string resolved = directory.empty() ? directory : resolvePath(directory);
+    if(!resolved.empty() && !isAbsolutePath(resolved))
+        resolved = getCwd() + "/" + resolved;
+    threadSettings().baseDirectory = resolved;
+}
+
+const string& IO::
+getBaseDirectory()
+{
+    return threadSettings().baseDirectory;
+}
+
+//_____________________________________________________________________________
+/**
+ * Prefix a relative file name with the base directory of the calling thread.
+ */
+string IO::
+resolvePath(const string& fileName)
+{
+    const string& base = threadSettings().baseDirectory;
+    if(base.empty() || fileName.empty() || isAbsolutePath(fileName))
+        return fileName;
+    const char last = base[base.size()-1];
+    if(last == '/' || last == '\\')
+        return base + fileName;
+    return base + "/" + fileName;
+}
+
+//_____________________________________________________________________________
+/**
+ * Whether the path starts at a root directory (or, on Windows, a drive).
+ */
+bool IO::
+isAbsolutePath(const string& path)
+{
+    if(path.empty()) return false;
+    if(path[0] == '/' || path[0] == '\\') return true;
+    return path.size() > 2 && isalpha((unsigned char)path[0]) &&
+           path[1] == ':' && (path[2] == '/' || path[2] == '\\');
+}
+
 //_____________________________________________________________________________
 /**
  * Get parent directory of the passed in fileName.
@@ -660,3 +728,17 @@ void IO::eraseEmptyElements(std::vector<std::string>& list)
             ++it;
     }
 }
+
+//=============================================================================
+// SCOPED BASE DIRECTORY
+//=============================================================================
+ScopedBaseDirectory::ScopedBaseDirectory(const string& directory) :
+    _previous(IO::getBaseDirectory())
+{
+    if(!directory.empty()) IO::setBaseDirectory(directory);
+}
+
+ScopedBaseDirectory::~ScopedBaseDirectory()
+{
+    threadSettings().baseDirectory = _previous;
+}
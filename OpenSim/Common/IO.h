@@ -31,6 +31,7 @@
 // INCLUDES
 #include "osimCommonDLL.h"
 #include <fstream>
+#include <string>
 #include <vector>
 
 // DEFINES
@@ -52,17 +53,8 @@ class OSIMCOMMON_API IO {
 // DATA
 //=============================================================================
 private:
-    // NUMBER OUTPUT
-    /** Specifies whether number output is in scientific or float format. */
-    static bool _Scientific;
-    /** Specifies whether number output is in %g format or not. */
-    static bool _GFormatForDoubleOutput;
-    /** Specifies number of digits of padding in number output. */ 
-    static int _Pad;
-    /** Specifies the precision of number output. */
-    static int _Precision;
-    /** The output format string. */
-    static char _DoubleFormat[256];
+    // The number output format (scientific, %g, pad, precision) and the
+    // base directory are kept per thread in IO.cpp.
     /** Whether offline documents should also be printed when Object::print is called. */
     static bool _PrintOfflineDocuments;
 
@@ -75,6 +67,8 @@ public:
     static char* ConstructDateAndTimeStamp();
     static std::string FixSlashesInFilePath(const std::string &path);
     // NUMBER OUTPUT FORMAT
+    // These settings apply to the calling thread only; each thread starts
+    // with the defaults (8 digits of precision and of padding, float format).
     static void SetScientific(bool aTrueFalse);
     static bool GetScientific();
     static void SetGFormatForDoubleOutput(bool aTrueFalse);
@@ -107,6 +101,21 @@ public:
     static int makeDir(const std::string &aDirName);
     static int chDir(const std::string &aDirName);
     static std::string getCwd();
+    /** Set the directory against which OpenSim resolves relative file names
+    on the calling thread, instead of changing the working directory of the
+    whole process with chDir(). A relative directory is itself resolved
+    against the current base directory (or the working directory of the
+    process), so the base directory is always absolute. An empty string (the
+    default) means the working directory of the process. Prefer
+    ScopedBaseDirectory, which restores the previous base directory. */
+    static void setBaseDirectory(const std::string& directory);
+    static const std::string& getBaseDirectory();
+    /** The file name prefixed with the base directory of the calling thread,
+    unless the file name is empty or absolute or no base directory is set.
+    The file opening methods of IO, XMLDocument, Storage and the
+    FileAdapters resolve their file names with this method. */
+    static std::string resolvePath(const std::string& fileName);
+    static bool isAbsolutePath(const std::string& path);
     static std::string getParentDirectory(const std::string& fileName);
     static std::string GetFileNameFromURI(const std::string& aURI);
     static std::string formatText(const std::string& aComment,const std::string& leadingWhitespace,int width,const std::string& endlineTokenToInsert="\n");
@@ -124,6 +133,24 @@ public:
 //=============================================================================
 };  // END CLASS IO
 
+#ifndef SWIG
+/** Set the base directory of the calling thread (see IO::setBaseDirectory())
+for the lifetime of this object. Tools use it to resolve the file names of
+their setup files relative to the directory of the setup file, without
+changing the working directory of the process, so that several tools can run
+at once on different threads. An empty directory leaves the base directory
+unchanged. */
+class OSIMCOMMON_API ScopedBaseDirectory {
+public:
+    explicit ScopedBaseDirectory(const std::string& directory);
+    ~ScopedBaseDirectory();
+    ScopedBaseDirectory(const ScopedBaseDirectory&) = delete;
+    ScopedBaseDirectory& operator=(const ScopedBaseDirectory&) = delete;
+private:
+    std::string _previous;
+};
+#endif
+
 }; //namespace
 //=============================================================================
 //=============================================================================
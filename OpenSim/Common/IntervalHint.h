@@ -0,0 +1,89 @@
+#ifndef OPENSIM_INTERVAL_HINT_H_
+#define OPENSIM_INTERVAL_HINT_H_
+/* -------------------------------------------------------------------------- *
+ *                          OpenSim:  IntervalHint.h                          *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2019 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include <atomic>
+
+namespace OpenSim {
+
+/** Remembers the knot interval of the last lookup into a monotonically
+increasing sequence of knots, so that the lookups of a simulation or of a
+sweep over a motion, which rarely move by more than one interval at a time,
+cost O(1) instead of a binary search.
+
+The hint is only a guess: find() checks it against the knots before using
+it and falls back to a binary search when it is stale. This makes it safe to
+share one const function between threads (the hint is an atomic that the
+threads may overwrite in any order) and safe to keep when the knots are
+edited. Copies of an IntervalHint start from the first interval.
+
+@code
+int k = _hint.find(_x.getSize(), t,
+                   [this](int i) { return _x[i]; });
+@endcode */
+class IntervalHint {
+public:
+    IntervalHint() = default;
+    IntervalHint(const IntervalHint&) {}
+    IntervalHint& operator=(const IntervalHint&) { return *this; }
+
+    /** Find the interval k in [0, n-2] such that knot(k) <= x < knot(k+1).
+    Abscissae below the first knot map to interval 0 and abscissae at or
+    above the last knot map to interval n-2. `knot` is any callable that
+    returns the i-th knot. */
+    template <typename Knot>
+    int find(int n, double x, const Knot& knot) const {
+        const int last = n - 2;
+        if (last <= 0) return 0;
+        int k = _k.load(std::memory_order_relaxed);
+        if (k > last) k = last;
+        if (!contains(k, last, x, knot)) {
+            // Try the next interval before searching the whole sequence.
+            if (k < last && contains(k + 1, last, x, knot)) {
+                ++k;
+            } else {
+                int lo = 0, hi = last;
+                while (lo < hi) {
+                    const int mid = (lo + hi + 1) / 2;
+                    if (knot(mid) <= x) lo = mid;
+                    else hi = mid - 1;
+                }
+                k = lo;
+            }
+        }
+        _k.store(k, std::memory_order_relaxed);
+        return k;
+    }
+
+private:
+    template <typename Knot>
+    static bool contains(int k, int last, double x, const Knot& knot) {
+        return (k == 0 || knot(k) <= x) && (k == last || x < knot(k + 1));
+    }
+
+    mutable std::atomic<int> _k{0};
+};
+
+} // namespace OpenSim
+
+#endif // OPENSIM_INTERVAL_HINT_H_
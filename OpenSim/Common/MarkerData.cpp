@@ -31,6 +31,7 @@
 #include "MarkerData.h"
 #include "SimmIO.h"
 #include "SimmMacros.h"
+#include "IO.h"
 #include "Storage.h"
 #include "OpenSim/Auxiliary/auxiliaryTestFunctions.h"
 #include "OpenSim/Common/STOFileAdapter.h"
@@ -145,7 +146,7 @@ void MarkerData::readTRCFile(const string& aFileName, MarkerData& aSMD)
     if (aFileName.empty())
         throw Exception("MarkerData.readTRCFile: ERROR- Marker file name is empty",__FILE__,__LINE__);
 
-   in.open(aFileName.c_str());
+   in.open(IO::resolvePath(aFileName).c_str());
 
     if (!in.good())
     {
@@ -435,7 +436,7 @@ void MarkerData::readTRBFile(const string& aFileName, MarkerData& aSMD)
 
    readTRBFileHeader(actualFileName, &trc->header, headerSize);
 
-   file = fopen(actualFileName.c_str(), "rb");
+   file = fopen(IO::resolvePath(actualFileName).c_str(), "rb");
 
    trc->frameList = new smTRCFrame [trc->header.numFrames];
 
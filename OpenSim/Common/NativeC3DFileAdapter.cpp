@@ -0,0 +1,572 @@
+/* -------------------------------------------------------------------------- *
+ *                     OpenSim:  NativeC3DFileAdapter.cpp                     *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2019 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "NativeC3DFileAdapter.h"
+#include "IO.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <map>
+
+namespace {
+
+using OpenSim::Exception;
+
+// A C3D file is a sequence of 512-byte blocks: a header block, the parameter
+// section, then the 3D point and analog data of each frame.
+const std::streamoff BlockSize = 512;
+
+// Point types that C3D files store alongside markers in the POINT group.
+const char* const NonMarkerPointGroups[] =
+        {"ANGLES", "FORCES", "MOMENTS", "POWERS", "SCALARS", "REACTIONS"};
+
+class C3DFile {
+public:
+    struct Parameter {
+        int type;               // -1 char, 1 byte, 2 int16, 4 float.
+        std::vector<int> dims;
+        std::vector<unsigned char> data;
+    };
+
+    explicit C3DFile(const std::string& fileName) : _fileName(fileName) {
+        _stream.open(IO::resolvePath(fileName), std::ios::binary);
+        OPENSIM_THROW_IF(!_stream.good(), OpenSim::FileDoesNotExist,
+                         fileName);
+
+        unsigned char header[BlockSize];
+        readBytes(0, header, BlockSize);
+        OPENSIM_THROW_IF(header[1] != 0x50, Exception,
+                "'" + fileName + "' is not a C3D file.");
+
+        // The processor type is only stored in the parameter section, but
+        // the header words are written in that processor's byte order.
+        const std::streamoff parameterStart = (header[0] - 1) * BlockSize;
+        unsigned char parameterHeader[4];
+        readBytes(parameterStart, parameterHeader, 4);
+        _processor = parameterHeader[3];
+        OPENSIM_THROW_IF(_processor < Intel || _processor > MIPS, Exception,
+                "'" + fileName + "' has an unknown processor type " +
+                std::to_string(_processor) + ".");
+
+        _numPoints = getUInt16(header + 2);
+        const int numAnalogValues = getUInt16(header + 4);
+        const int firstFrame = getUInt16(header + 6);
+        const int lastFrame = getUInt16(header + 8);
+        const float scale = getFloat(header + 12);
+        _dataStart = (getUInt16(header + 16) - 1) * BlockSize;
+        _analogSamplesPerFrame = getUInt16(header + 18);
+        _frameRate = getFloat(header + 20);
+
+        _isFloat = scale < 0;
+        _pointScale = std::abs(scale);
+        _numAnalogChannels = _analogSamplesPerFrame > 0 ?
+                numAnalogValues / _analogSamplesPerFrame : 0;
+        _numFrames = lastFrame - firstFrame + 1;
+
+        std::vector<unsigned char> parameters(parameterHeader[2] * BlockSize);
+        readBytes(parameterStart, parameters.data(),
+                  static_cast<std::streamsize>(parameters.size()));
+        parseParameters(parameters);
+
+        // The header stores frame numbers as 16-bit words; longer trials
+        // keep the actual range as two words in the TRIAL group.
+        const auto start = getInts("TRIAL:ACTUAL_START_FIELD");
+        const auto end = getInts("TRIAL:ACTUAL_END_FIELD");
+        if (start.size() == 2 && end.size() == 2) {
+            const long first = (start[0] & 0xffff) + 65536L*(start[1] & 0xffff);
+            const long last = (end[0] & 0xffff) + 65536L*(end[1] & 0xffff);
+            if (last >= first) _numFrames = static_cast<int>(last - first + 1);
+        }
+        if (_frameRate <= 0) {
+            const auto rate = getFloats("POINT:RATE");
+            OPENSIM_THROW_IF(rate.empty() || rate[0] <= 0, Exception,
+                    "'" + fileName + "' does not specify a frame rate.");
+            _frameRate = rate[0];
+        }
+    }
+
+    int getNumFrames() const { return _numFrames; }
+    double getFrameRate() const { return _frameRate; }
+    int getAnalogSamplesPerFrame() const { return _analogSamplesPerFrame; }
+
+    double getAnalogRate() const {
+        const auto rate = getFloats("ANALOG:RATE");
+        return !rate.empty() && rate[0] > 0 ? rate[0]
+                : _frameRate * _analogSamplesPerFrame;
+    }
+
+    std::string getPointUnits() const {
+        const auto units = getStrings("POINT:UNITS");
+        return units.empty() ? std::string{} : units[0];
+    }
+
+    /// Indices of the points that are markers, and their names.
+    void getMarkers(std::vector<int>& indices,
+                    std::vector<std::string>& names) const {
+        const auto labels = getLabels("POINT", _numPoints);
+        std::vector<std::string> nonMarkers;
+        for (const char* group : NonMarkerPointGroups) {
+            const auto points = getStrings(std::string("POINT:") + group);
+            nonMarkers.insert(nonMarkers.end(), points.begin(), points.end());
+        }
+        for (int p = 0; p < _numPoints; ++p) {
+            if (std::find(nonMarkers.begin(), nonMarkers.end(), labels[p]) !=
+                    nonMarkers.end())
+                continue;
+            indices.push_back(p);
+            names.push_back(labels[p]);
+        }
+    }
+
+    std::vector<std::string> getAnalogLabels() const {
+        return getLabels("ANALOG", _numAnalogChannels);
+    }
+
+    std::vector<std::string> getAnalogUnits() const {
+        auto units = getStrings("ANALOG:UNITS");
+        units.resize(_numAnalogChannels);
+        return units;
+    }
+
+    /// Decode the requested frames into `markers` (one row per frame) and
+    /// `analogs` (one row per analog sample). Either output is skipped if
+    /// it has no columns.
+    void read(int firstFrame, int numFrames,
+              const std::vector<int>& pointIndices,
+              const std::vector<int>& channelIndices,
+              SimTK::Matrix_<SimTK::Vec3>& markers,
+              SimTK::Matrix& analogs) const {
+        const int wordSize = _isFloat ? 4 : 2;
+        const std::streamoff pointBytes = 4 * wordSize * _numPoints;
+        const std::streamoff frameBytes = pointBytes +
+                wordSize * _numAnalogChannels * _analogSamplesPerFrame;
+
+        // Analog conversion factors, for the requested channels only.
+        const auto scales = getFloats("ANALOG:SCALE");
+        const auto offsets = getInts("ANALOG:OFFSET");
+        const auto genScale = getFloats("ANALOG:GEN_SCALE");
+        const auto format = getStrings("ANALOG:FORMAT");
+        const bool isUnsigned = !format.empty() && format[0] == "UNSIGNED";
+        const size_t numChannels = channelIndices.size();
+        std::vector<double> channelScale(numChannels);
+        std::vector<double> channelOffset(numChannels);
+        for (size_t i = 0; i < numChannels; ++i) {
+            const int c = channelIndices[i];
+            channelScale[i] = (c < (int)scales.size() ? scales[c] : 1.0) *
+                    (genScale.empty() ? 1.0 : genScale[0]);
+            const int offset = c < (int)offsets.size() ? offsets[c] : 0;
+            channelOffset[i] = isUnsigned ? (offset & 0xffff) : offset;
+        }
+
+        const bool readPoints = !pointIndices.empty();
+        const bool readAnalogs = numChannels > 0 && _analogSamplesPerFrame > 0;
+        if (readPoints) markers.resize(numFrames, (int)pointIndices.size());
+        if (readAnalogs)
+            analogs.resize(numFrames * _analogSamplesPerFrame,
+                           (int)numChannels);
+        if (numFrames == 0 || (!readPoints && !readAnalogs)) return;
+
+        // Frames have a fixed size, so jump straight to the first requested
+        // frame and decode the data in blocks of about 1 MB.
+        const int framesPerBlock = static_cast<int>(
+                std::max<std::streamoff>(1, (1 << 20) / frameBytes));
+        std::vector<unsigned char> buffer(framesPerBlock * frameBytes);
+        const SimTK::Vec3 missing(SimTK::NaN);
+
+        for (int f0 = 0; f0 < numFrames; f0 += framesPerBlock) {
+            const int n = std::min(framesPerBlock, numFrames - f0);
+            readBytes(_dataStart + (firstFrame + f0) * frameBytes,
+                      buffer.data(), n * frameBytes);
+
+            for (int f = 0; f < n; ++f) {
+                const unsigned char* frame = buffer.data() + f * frameBytes;
+                const int row = f0 + f;
+
+                for (size_t i = 0; readPoints && i < pointIndices.size(); ++i) {
+                    const unsigned char* point =
+                            frame + 4 * wordSize * pointIndices[i];
+                    if (_isFloat) {
+                        // A negative residual flags an invalid sample.
+                        if (getFloat(point + 12) < 0)
+                            markers(row, (int)i) = missing;
+                        else
+                            markers(row, (int)i) = SimTK::Vec3(
+                                    getFloat(point), getFloat(point + 4),
+                                    getFloat(point + 8));
+                    } else {
+                        if (getInt16(point + 6) < 0)
+                            markers(row, (int)i) = missing;
+                        else
+                            markers(row, (int)i) = _pointScale * SimTK::Vec3(
+                                    double(getInt16(point)),
+                                    double(getInt16(point + 2)),
+                                    double(getInt16(point + 4)));
+                    }
+                }
+
+                if (!readAnalogs) continue;
+                const unsigned char* analog = frame + pointBytes;
+                for (int s = 0; s < _analogSamplesPerFrame; ++s) {
+                    const unsigned char* sample =
+                            analog + wordSize * s * _numAnalogChannels;
+                    const int analogRow = row * _analogSamplesPerFrame + s;
+                    for (size_t i = 0; i < numChannels; ++i) {
+                        const unsigned char* value =
+                                sample + wordSize * channelIndices[i];
+                        const double raw = _isFloat ? getFloat(value)
+                                : isUnsigned ? getUInt16(value)
+                                : getInt16(value);
+                        analogs(analogRow, (int)i) =
+                                (raw - channelOffset[i]) * channelScale[i];
+                    }
+                }
+            }
+        }
+    }
+
+private:
+    enum Processor { Intel = 84, DEC = 85, MIPS = 86 };
+
+    void readBytes(std::streamoff position, unsigned char* buffer,
+                   std::streamsize count) const {
+        _stream.seekg(position);
+        _stream.read(reinterpret_cast<char*>(buffer), count);
+        OPENSIM_THROW_IF(_stream.gcount() != count, Exception,
+                "'" + _fileName + "' is truncated.");
+    }
+
+    // Intel and DEC processors are little-endian; MIPS is big-endian.
+    int getUInt16(const unsigned char* b) const {
+        return _processor == MIPS ? (b[0] << 8) | b[1] : b[0] | (b[1] << 8);
+    }
+    int getInt16(const unsigned char* b) const {
+        return static_cast<std::int16_t>(getUInt16(b));
+    }
+    float getFloat(const unsigned char* b) const {
+        unsigned char bytes[4];
+        if (_processor == MIPS) {
+            bytes[0] = b[3]; bytes[1] = b[2]; bytes[2] = b[1]; bytes[3] = b[0];
+        } else if (_processor == DEC) {
+            // A VAX float has its 16-bit words swapped and is 4 times the
+            // IEEE float with the same bits.
+            bytes[0] = b[2]; bytes[1] = b[3]; bytes[2] = b[0]; bytes[3] = b[1];
+        } else {
+            std::memcpy(bytes, b, 4);
+        }
+        float value;
+        std::memcpy(&value, bytes, 4);
+        return _processor == DEC ? value / 4 : value;
+    }
+
+    void parseParameters(const std::vector<unsigned char>& section) {
+        std::map<int, std::string> groups;
+        std::vector<std::pair<int, std::pair<std::string, Parameter>>> params;
+
+        // Skip the 4-byte parameter section header.
+        size_t pos = 4;
+        while (pos + 2 <= section.size()) {
+            const int nameLength = std::abs((signed char)section[pos]);
+            const int id = (signed char)section[pos + 1];
+            if (nameLength == 0 || id == 0) break;
+            const size_t namePos = pos + 2;
+            const size_t offsetPos = namePos + nameLength;
+            if (offsetPos + 2 > section.size()) break;
+            const std::string name(section.begin() + namePos,
+                                   section.begin() + offsetPos);
+            const int next = getInt16(&section[offsetPos]);
+
+            if (id < 0) {
+                groups[-id] = name;
+            } else if (offsetPos + 4 <= section.size()) {
+                Parameter param;
+                param.type = (signed char)section[offsetPos + 2];
+                const int numDims = section[offsetPos + 3];
+                size_t dataPos = offsetPos + 4 + numDims;
+                size_t count = 1;
+                for (int d = 0; d < numDims &&
+                        offsetPos + 4 + d < section.size(); ++d) {
+                    param.dims.push_back(section[offsetPos + 4 + d]);
+                    count *= param.dims.back();
+                }
+                const size_t dataEnd = dataPos + count*std::abs(param.type);
+                if (dataEnd <= section.size())
+                    param.data.assign(section.begin() + dataPos,
+                                      section.begin() + dataEnd);
+                params.push_back({id, {name, std::move(param)}});
+            }
+            if (next <= 0) break;
+            pos = offsetPos + next;
+        }
+
+        for (auto& param : params) {
+            const auto group = groups.find(param.first);
+            if (group == groups.end()) continue;
+            _parameters[group->second + ":" + param.second.first] =
+                    std::move(param.second.second);
+        }
+    }
+
+    const Parameter* findParameter(const std::string& name) const {
+        const auto it = _parameters.find(name);
+        return it == _parameters.end() ? nullptr : &it->second;
+    }
+
+    std::vector<int> getInts(const std::string& name) const {
+        std::vector<int> values;
+        const Parameter* param = findParameter(name);
+        if (!param) return values;
+        if (param->type == 2) {
+            for (size_t i = 0; i + 1 < param->data.size(); i += 2)
+                values.push_back(getInt16(&param->data[i]));
+        } else if (param->type == 1) {
+            for (unsigned char byte : param->data) values.push_back(byte);
+        }
+        return values;
+    }
+
+    std::vector<double> getFloats(const std::string& name) const {
+        std::vector<double> values;
+        const Parameter* param = findParameter(name);
+        if (!param) return values;
+        if (param->type == 4) {
+            for (size_t i = 0; i + 3 < param->data.size(); i += 4)
+                values.push_back(getFloat(&param->data[i]));
+        } else {
+            for (int value : getInts(name)) values.push_back(value);
+        }
+        return values;
+    }
+
+    /// Character parameters are arrays of fixed-width, space-padded strings
+    /// (the first dimension is the width).
+    std::vector<std::string> getStrings(const std::string& name) const {
+        std::vector<std::string> values;
+        const Parameter* param = findParameter(name);
+        if (!param || param->type != -1) return values;
+        const size_t width = param->dims.empty() ? param->data.size()
+                                                 : param->dims[0];
+        for (size_t i = 0; width > 0 && i < param->data.size(); i += width) {
+            std::string value(param->data.begin() + i, param->data.begin() +
+                    std::min(i + width, param->data.size()));
+            const size_t last = value.find_last_not_of(std::string(" \0", 2));
+            value.erase(last == std::string::npos ? 0 : last + 1);
+            values.push_back(value);
+        }
+        return values;
+    }
+
+    /// Labels continue in LABELS2, LABELS3, ... when there are more than
+    /// 255 of them. Unlabeled entries get a name from their index.
+    std::vector<std::string> getLabels(const std::string& group,
+                                       int count) const {
+        auto labels = getStrings(group + ":LABELS");
+        for (int i = 2; (int)labels.size() < count; ++i) {
+            const auto more =
+                    getStrings(group + ":LABELS" + std::to_string(i));
+            if (more.empty()) break;
+            labels.insert(labels.end(), more.begin(), more.end());
+        }
+        labels.resize(count);
+        for (int i = 0; i < count; ++i)
+            if (labels[i].empty())
+                labels[i] = (group == "POINT" ? "Point" : "Channel") +
+                            std::to_string(i + 1);
+        return labels;
+    }
+
+    std::string _fileName;
+    mutable std::ifstream _stream;
+    int _processor;
+    int _numPoints;
+    int _numAnalogChannels;
+    int _analogSamplesPerFrame;
+    int _numFrames;
+    std::streamoff _dataStart;
+    bool _isFloat;
+    double _pointScale;
+    double _frameRate;
+    std::map<std::string, Parameter> _parameters;
+};
+
+/// Indices into `available` of the `requested` names, or of all of them if
+/// none are requested.
+std::vector<int> selectColumns(const std::vector<std::string>& available,
+                               const std::vector<std::string>& requested,
+                               const std::string& kind,
+                               const std::string& fileName) {
+    std::vector<int> columns;
+    if (requested.empty()) {
+        for (int i = 0; i < (int)available.size(); ++i) columns.push_back(i);
+        return columns;
+    }
+    for (const auto& name : requested) {
+        const auto it = std::find(available.begin(), available.end(), name);
+        OPENSIM_THROW_IF(it == available.end(), Exception,
+                kind + " '" + name + "' not found in '" + fileName + "'.");
+        columns.push_back(static_cast<int>(it - available.begin()));
+    }
+    return columns;
+}
+
+} // anonymous namespace
+
+namespace OpenSim {
+
+const std::string NativeC3DFileAdapter::_markers{"markers"};
+const std::string NativeC3DFileAdapter::_analogs{"analogs"};
+
+NativeC3DFileAdapter*
+NativeC3DFileAdapter::clone() const {
+    return new NativeC3DFileAdapter{*this};
+}
+
+TimeSeriesTableVec3
+NativeC3DFileAdapter::readMarkers(const std::string& fileName,
+                                  const std::vector<std::string>& markerNames,
+                                  double initialTime, double finalTime) {
+    NativeC3DFileAdapter reader{};
+    reader.setMarkerNames(markerNames);
+    reader.setTimeRange(initialTime, finalTime);
+    reader.setReadAnalogs(false);
+    auto tables = reader.extendRead(fileName);
+    OPENSIM_THROW_IF(!tables.count(_markers), Exception,
+            "'" + fileName + "' has no markers.");
+    return *std::static_pointer_cast<TimeSeriesTableVec3>(
+            tables.at(_markers));
+}
+
+TimeSeriesTable
+NativeC3DFileAdapter::readAnalogs(const std::string& fileName,
+                                  const std::vector<std::string>& channelNames,
+                                  double initialTime, double finalTime) {
+    NativeC3DFileAdapter reader{};
+    reader.setAnalogChannelNames(channelNames);
+    reader.setTimeRange(initialTime, finalTime);
+    reader.setReadMarkers(false);
+    auto tables = reader.extendRead(fileName);
+    OPENSIM_THROW_IF(!tables.count(_analogs), Exception,
+            "'" + fileName + "' has no analog channels.");
+    return *std::static_pointer_cast<TimeSeriesTable>(tables.at(_analogs));
+}
+
+NativeC3DFileAdapter::OutputTables
+NativeC3DFileAdapter::extendRead(const std::string& fileName) const {
+    OPENSIM_THROW_IF(_initialTime > _finalTime, Exception,
+            "Initial time (" + std::to_string(_initialTime) + ") is after "
+            "final time (" + std::to_string(_finalTime) + ").");
+
+    const C3DFile file(fileName);
+    const double rate = file.getFrameRate();
+
+    // Frames whose time lies within the requested range; a small tolerance
+    // keeps frames whose time is only off by round-off.
+    const double tol = 1e-6;
+    int firstFrame = 0;
+    int lastFrame = file.getNumFrames() - 1;
+    if (_initialTime > 0)
+        firstFrame = std::max(firstFrame,
+                static_cast<int>(std::ceil(_initialTime * rate - tol)));
+    if (_finalTime < lastFrame / rate)
+        lastFrame = std::min(lastFrame,
+                static_cast<int>(std::floor(_finalTime * rate + tol)));
+    const int numFrames = std::max(0, lastFrame - firstFrame + 1);
+
+    std::vector<int> pointIndices;
+    std::vector<std::string> markerLabels;
+    if (_readMarkers) {
+        std::vector<int> allIndices;
+        std::vector<std::string> allNames;
+        file.getMarkers(allIndices, allNames);
+        for (int i : selectColumns(allNames, _markerNames, "Marker",
+                                   fileName)) {
+            pointIndices.push_back(allIndices[i]);
+            markerLabels.push_back(allNames[i]);
+        }
+    }
+
+    std::vector<int> channelIndices;
+    std::vector<std::string> channelLabels;
+    ValueArray<std::string> channelUnits{};
+    if (_readAnalogs && file.getAnalogSamplesPerFrame() > 0) {
+        const auto labels = file.getAnalogLabels();
+        const auto units = file.getAnalogUnits();
+        channelIndices = selectColumns(labels, _analogChannelNames,
+                                       "Analog channel", fileName);
+        for (int c : channelIndices) {
+            channelLabels.push_back(labels[c]);
+            channelUnits.upd().push_back(SimTK::Value<std::string>(units[c]));
+        }
+    }
+
+    SimTK::Matrix_<SimTK::Vec3> markerMatrix;
+    SimTK::Matrix analogMatrix;
+    file.read(firstFrame, numFrames, pointIndices, channelIndices,
+              markerMatrix, analogMatrix);
+
+    OutputTables tables{};
+
+    if (!pointIndices.empty()) {
+        std::vector<double> times(numFrames);
+        for (int f = 0; f < numFrames; ++f)
+            times[f] = (firstFrame + f) / rate;
+
+        auto markerTable = std::make_shared<TimeSeriesTableVec3>(times,
+                markerMatrix, markerLabels);
+        markerTable->updTableMetaData().setValueForKey("DataRate",
+                std::to_string(rate));
+        const std::string units = file.getPointUnits();
+        if (!units.empty())
+            markerTable->updTableMetaData().setValueForKey("Units", units);
+        tables.emplace(_markers, markerTable);
+    }
+
+    if (!channelIndices.empty()) {
+        const int samplesPerFrame = file.getAnalogSamplesPerFrame();
+        const double analogRate = file.getAnalogRate();
+        std::vector<double> times(numFrames * samplesPerFrame);
+        for (int s = 0; s < (int)times.size(); ++s)
+            times[s] = (firstFrame * samplesPerFrame + s) / analogRate;
+
+        auto analogTable = std::make_shared<TimeSeriesTable>(times,
+                analogMatrix, channelLabels);
+        TimeSeriesTable::DependentsMetaData metadata =
+                analogTable->getDependentsMetaData();
+        metadata.setValueArrayForKey("units", channelUnits);
+        analogTable->setDependentsMetaData(metadata);
+        analogTable->updTableMetaData().setValueForKey("DataRate",
+                std::to_string(analogRate));
+        tables.emplace(_analogs, analogTable);
+    }
+
+    return tables;
+}
+
+void
+NativeC3DFileAdapter::extendWrite(const InputTables& tables,
+                                  const std::string& fileName) const {
+    OPENSIM_THROW(Exception, "Writing C3D files is not supported.");
+}
+
+} // namespace OpenSim
@@ -0,0 +1,141 @@
+/* -------------------------------------------------------------------------- *
+ *                      OpenSim:  NativeC3DFileAdapter.h                      *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2019 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#ifndef OPENSIM_NATIVE_C3D_FILE_ADAPTER_H_
+#define OPENSIM_NATIVE_C3D_FILE_ADAPTER_H_
+
+#include "FileAdapter.h"
+#include "TimeSeriesTable.h"
+
+namespace OpenSim {
+
+/** NativeC3DFileAdapter reads the 3D point and analog data of a C3D file
+(https://www.c3d.org) without depending on BTK. Files written by Intel, DEC
+and MIPS processors, in either the integer or the floating-point format, are
+supported.
+
+Reading produces up to two tables:
+- "markers": a TimeSeriesTableVec3 with one column per marker, labeled by the
+  marker name. Points that the file lists as angles, forces, moments, powers
+  or scalars are not markers and are skipped. Samples the file flags as
+  invalid (negative residual) are NaN. The table metadata holds the
+  "DataRate" and the "Units" of the points.
+- "analogs": a TimeSeriesTable with one column per analog channel (force
+  plate channels, EMG, accelerometers, ...) at the analog sampling rate. The
+  raw values are converted to physical units using the channel offsets and
+  scales of the file, and the "units" of each channel are kept in the
+  dependents metadata.
+
+Only the requested markers, channels and frames are decoded: the reader
+seeks to the first requested frame and decodes the data in blocks straight
+into the tables. Unlike C3DFileAdapter, force-plate wrenches are not
+computed; use C3DFileAdapter (which requires BTK) for those.
+
+@code
+auto markers = NativeC3DFileAdapter::readMarkers("walk.c3d",
+                                                 {"RASI", "LASI"}, 0.5, 1.5);
+auto emg = NativeC3DFileAdapter::readAnalogs("walk.c3d");
+@endcode
+*/
+class OSIMCOMMON_API NativeC3DFileAdapter : public FileAdapter {
+public:
+    NativeC3DFileAdapter()                                       = default;
+    NativeC3DFileAdapter(const NativeC3DFileAdapter&)            = default;
+    NativeC3DFileAdapter(NativeC3DFileAdapter&&)                 = default;
+    NativeC3DFileAdapter& operator=(const NativeC3DFileAdapter&) = default;
+    NativeC3DFileAdapter& operator=(NativeC3DFileAdapter&&)      = default;
+    ~NativeC3DFileAdapter()                                      = default;
+
+    NativeC3DFileAdapter* clone() const override;
+
+    /** Read only the markers with these names, in this order. An empty list
+    (the default) reads all markers. */
+    void setMarkerNames(const std::vector<std::string>& markerNames) {
+        _markerNames = markerNames;
+    }
+    const std::vector<std::string>& getMarkerNames() const {
+        return _markerNames;
+    }
+
+    /** Read only the analog channels with these labels, in this order. An
+    empty list (the default) reads all channels. */
+    void setAnalogChannelNames(const std::vector<std::string>& channelNames) {
+        _analogChannelNames = channelNames;
+    }
+    const std::vector<std::string>& getAnalogChannelNames() const {
+        return _analogChannelNames;
+    }
+
+    /** Read only the frames whose time lies within [initialTime, finalTime].
+    Times start at 0 for the first frame of the file. All frames are read by
+    default. */
+    void setTimeRange(double initialTime, double finalTime) {
+        _initialTime = initialTime;
+        _finalTime = finalTime;
+    }
+    double getInitialTime() const { return _initialTime; }
+    double getFinalTime() const { return _finalTime; }
+
+    /** Whether to read the markers and the analog channels. Both are read by
+    default. */
+    void setReadMarkers(bool readMarkers) { _readMarkers = readMarkers; }
+    bool getReadMarkers() const { return _readMarkers; }
+    void setReadAnalogs(bool readAnalogs) { _readAnalogs = readAnalogs; }
+    bool getReadAnalogs() const { return _readAnalogs; }
+
+    /** Read the markers of a C3D file. See setMarkerNames() and
+    setTimeRange() for the meaning of the optional arguments. */
+    static TimeSeriesTableVec3 readMarkers(const std::string& fileName,
+            const std::vector<std::string>& markerNames =
+                    std::vector<std::string>(),
+            double initialTime = -SimTK::Infinity,
+            double finalTime = SimTK::Infinity);
+
+    /** Read the analog channels of a C3D file. See setAnalogChannelNames()
+    and setTimeRange() for the meaning of the optional arguments. */
+    static TimeSeriesTable readAnalogs(const std::string& fileName,
+            const std::vector<std::string>& channelNames =
+                    std::vector<std::string>(),
+            double initialTime = -SimTK::Infinity,
+            double finalTime = SimTK::Infinity);
+
+    static const std::string _markers;
+    static const std::string _analogs;
+
+protected:
+    OutputTables extendRead(const std::string& fileName) const override;
+
+    void extendWrite(const InputTables& tables,
+                     const std::string& fileName) const override;
+
+private:
+    std::vector<std::string> _markerNames;
+    std::vector<std::string> _analogChannelNames;
+    double _initialTime{-SimTK::Infinity};
+    double _finalTime{SimTK::Infinity};
+    bool _readMarkers{true};
+    bool _readAnalogs{true};
+};
+
+} // namespace OpenSim
+
+#endif // OPENSIM_NATIVE_C3D_FILE_ADAPTER_H_
@@ -37,7 +37,10 @@
 #include "PropertyTransform.h"
 #include "IO.h"
 
+#include <algorithm>
+#include <exception>
 #include <fstream>
+#include <thread>
 
 using namespace OpenSim;
 using namespace std;
@@ -99,7 +102,7 @@ Object::Object(const string &aFileName, bool aUpdateFromXMLNode)
         getClassName() + 
         ": Cannot construct from empty filename. No filename specified.");
 
-    OPENSIM_THROW_IF(!ifstream(aFileName.c_str(), ios_base::in).good(),
+    OPENSIM_THROW_IF(!IO::FileExists(aFileName),
         Exception,
         getClassName() + ": Cannot open file " + aFileName +
         ". It may not exist or you do not have permission to read it.");
@@ -110,21 +113,12 @@ Object::Object(const string &aFileName, bool aUpdateFromXMLNode)
     SimTK::Xml::Element myNode =  _document->getRootDataElement(); //either actual root or node after OpenSimDocument
 
     // UPDATE OBJECT
-    // Set current working directory to directory in which we found
-    // the XML document so that contained file names will be interpreted
-    // relative to that directory. Make sure we switch back properly in case
-    // of an exception.
+    // Resolve contained file names relative to the directory in which we
+    // found the XML document, on this thread only.
     if (aUpdateFromXMLNode) {
-        const string saveWorkingDirectory = IO::getCwd();
-        const string directoryOfXMLFile = IO::getParentDirectory(aFileName);
-        IO::chDir(directoryOfXMLFile);
-        try {
-            updateFromXMLNode(myNode, _document->getDocumentVersion());
-        } catch (...) {
-            IO::chDir(saveWorkingDirectory);
-            throw; // re-issue the exception
-        }
-        IO::chDir(saveWorkingDirectory);
+        ScopedBaseDirectory directoryOfXMLFile(
+                IO::getParentDirectory(aFileName));
+        updateFromXMLNode(myNode, _document->getDocumentVersion());
     }
 }
 //_____________________________________________________________________________
@@ -714,17 +708,17 @@ void Object::readObjectFromXMLNodeOrFile
     // This object specifies an external file from which it should be read.
 
     // When including contents from another file it's assumed file path is 
-    // relative to the current working directory, which is usually set to be
-    // the directory that contained the top-level XML file.
+    // relative to the base directory (see IO::resolvePath()), which is
+    // usually set to be the directory that contained the top-level XML file.
     XMLDocument* newDoc=0;
     try {
-        std::cout << "reading object from file [" << file <<"] cwd =" 
-                  << IO::getCwd() << std::endl;
+        std::cout << "reading object from file [" << IO::resolvePath(file)
+                  << "]" << std::endl;
          newDoc = new XMLDocument(file);
         _document = newDoc;
     } catch(const std::exception& ex){
-        std::cout << "failure reading object from file [" << file <<"] cwd =" 
-            << IO::getCwd() << "Error:" << ex.what() << std::endl;
+        std::cout << "failure reading object from file ["
+            << IO::resolvePath(file) << "] Error:" << ex.what() << std::endl;
         return;
     }
     _inlined=false;
@@ -805,10 +799,42 @@ try {
     updateDefaultObjectsFromXMLNode(); // May need to pass in aNode
 
     // LOOP THROUGH PROPERTIES
-    for(int i=0; i < _propertyTable.getNumProperties(); ++i) {
-        AbstractProperty& prop = _propertyTable.updAbstractPropertyByIndex(i);
-        prop.readFromXMLParentElement(aNode, versionNumber);
+    // The properties that can be read concurrently are each read on a thread
+    // of their own, which resolves file names against the same base
+    // directory as this thread, while this thread reads the others.
+    std::vector<int> concurrent = 
+        getPropertiesToReadConcurrently(versionNumber);
+    if (std::thread::hardware_concurrency() < 2) concurrent.clear();
+    std::vector<std::exception_ptr> errors(concurrent.size() + 1);
+    std::vector<std::thread> threads;
+    const std::string baseDirectory = IO::getBaseDirectory();
+    for(size_t k=0; k < concurrent.size(); ++k) {
+        AbstractProperty& prop = 
+            _propertyTable.updAbstractPropertyByIndex(concurrent[k]);
+        threads.emplace_back([&prop, &aNode, &errors, &baseDirectory,
+                              versionNumber, k] {
+            try {
+                ScopedBaseDirectory base(baseDirectory);
+                prop.readFromXMLParentElement(aNode, versionNumber);
+            } catch (...) {
+                errors[k + 1] = std::current_exception();
+            }
+        });
+    }
+    try {
+        for(int i=0; i < _propertyTable.getNumProperties(); ++i) {
+            if (std::find(concurrent.begin(), concurrent.end(), i) 
+                    != concurrent.end()) continue;
+            AbstractProperty& prop = 
+                _propertyTable.updAbstractPropertyByIndex(i);
+            prop.readFromXMLParentElement(aNode, versionNumber);
+        }
+    } catch (...) {
+        errors[0] = std::current_exception();
     }
+    for (auto& thread : threads) thread.join();
+    for (const auto& error : errors)
+        if (error) std::rethrow_exception(error);
 
     // LOOP THROUGH DEPRECATED PROPERTIES
     // TODO: get rid of this
@@ -1370,10 +1396,10 @@ print(const string &aFileName) const
     try {
         warnBeforePrint();
     } catch (...) {}
-    // Temporarily change current directory so that inlined files are written to correct relative directory
-    std::string savedCwd = IO::getCwd();
-    IO::chDir(IO::getParentDirectory(aFileName));
-    try {
+    {
+        // Temporarily change the base directory so that offline files are
+        // written to the correct relative directory.
+        ScopedBaseDirectory directoryOfFile(IO::getParentDirectory(aFileName));
         XMLDocument* oldDoc = NULL;
         if (_document != NULL){
             oldDoc = _document;
@@ -1386,13 +1412,7 @@ print(const string &aFileName) const
         }
         SimTK::Xml::Element e = _document->getRootElement(); 
         updateXMLNode(e);
-    } catch (const Exception &ex) {
-        // Important to catch exceptions here so we can restore current working directory...
-        // And then we can re-throw the exception
-        IO::chDir(savedCwd);
-        throw(ex);
     }
-    IO::chDir(savedCwd);
     if(_document==NULL) return false;
     _document->print(aFileName);
     return true;
@@ -1572,24 +1592,17 @@ makeObjectFromFile(const std::string &aFileName)
         }
         Object* newObject = newInstanceOfType(rootName);
         if(!newObject) throw Exception("Unrecognized XML element '"+rootName+"' and root of file '"+aFileName+"'",__FILE__,__LINE__);
-        // Here file is deemed legit, chdir to where the file lives here and restore at the end so offline objects are handled properly
-        const string saveWorkingDirectory = IO::getCwd();
-        const string directoryOfXMLFile = IO::getParentDirectory(aFileName);
-        IO::chDir(directoryOfXMLFile);
-        //cout << "File name = "<< aFileName << "Cwd is now "<< directoryOfXMLFile << endl;
-        try {
-            newObject->_document=doc;
-            if (newFormat)
-                newObject->updateFromXMLNode(*doc->getRootElement().element_begin(), doc->getDocumentVersion());
-            else { 
-                SimTK::Xml::Element e = doc->getRootElement();
-                newObject->updateFromXMLNode(e, 10500);
-            }
-        } catch (...) {
-            IO::chDir(saveWorkingDirectory);
-            throw; // re-issue the exception
+        // Here file is deemed legit; resolve file names relative to where the
+        // file lives so offline objects are handled properly.
+        ScopedBaseDirectory directoryOfXMLFile(
+                IO::getParentDirectory(aFileName));
+        newObject->_document=doc;
+        if (newFormat)
+            newObject->updateFromXMLNode(*doc->getRootElement().element_begin(), doc->getDocumentVersion());
+        else { 
+            SimTK::Xml::Element e = doc->getRootElement();
+            newObject->updateFromXMLNode(e, 10500);
         }
-        IO::chDir(saveWorkingDirectory);
         return (newObject);
     }
 
@@ -1639,12 +1652,10 @@ void Object::updateFromXMLDocument()
     assert(_document!= 0);
     
     SimTK::Xml::Element e = _document->getRootDataElement(); 
-    const string saveWorkingDirectory = IO::getCwd();
     string parentFileName = _document->getFileName();
-    const string directoryOfXMLFile = IO::getParentDirectory(parentFileName);
-    IO::chDir(directoryOfXMLFile);
+    ScopedBaseDirectory directoryOfXMLFile(
+            IO::getParentDirectory(parentFileName));
     updateFromXMLNode(e, _document->getDocumentVersion());
-    IO::chDir(saveWorkingDirectory);
 }
 
 std::string Object::dump() const {
@@ -42,6 +42,8 @@
 
 #include <cstring>
 #include <cassert>
+#include <map>
+#include <vector>
 
 // DISABLES MULTIPLE INSTANTIATION WARNINGS
 
@@ -558,6 +560,17 @@ protected:
         _objectIsUpToDate = false;
     }
 
+    /** Return the indices of the properties that updateFromXMLNode() may read
+    concurrently, each on a thread of its own, while the calling thread reads
+    the other properties. Reading one of these properties must not touch the
+    XML elements or the values of any other property. The default is none;
+    Model, for example, reads its independent component sets this way.
+    @param versionNumber    the version of the XML being read **/
+    virtual std::vector<int> getPropertiesToReadConcurrently(
+            int versionNumber) const {
+        return {};
+    }
+
     /** Make sure the name of an object is consistent with its property type. A
     name can be changed independent of the property name, which may be inconsistent
     with any restrictions specified by the Property. For example, unnamed property
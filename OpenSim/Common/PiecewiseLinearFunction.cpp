@@ -443,19 +443,9 @@ double PiecewiseLinearFunction::calcValue(const Vector& x) const
     else if (EQUAL_WITHIN_ERROR(aX,_x[n-1]))
         return _y[n-1];
 
-    // Do a binary search to find which two points the abscissa is between.
-    int k, i = 0;
-    int j = n;
-    while (1)
-    {
-        k = (i+j)/2;
-        if (aX < _x[k])
-            j = k;
-        else if (aX > _x[k+1])
-            i = k;
-        else
-            break;
-    }
+    // Find which two points the abscissa is between, starting from the
+    // interval of the previous evaluation.
+    const int k = _interval.find(n, aX, [this](int i) { return _x[i]; });
 
     return _y[k] + (aX - _x[k]) * _b[k];
 }
@@ -486,19 +476,9 @@ double PiecewiseLinearFunction::calcDerivative(const std::vector<int>& derivComp
         return _b[n-1];
     }
 
-    // Do a binary search to find which two points the abscissa is between.
-    int k, i = 0;
-    int j = n;
-    while (1)
-    {
-        k = (i+j)/2;
-        if (aX < _x[k])
-            j = k;
-        else if (aX > _x[k+1])
-            i = k;
-        else
-            break;
-    }
+    // Find which two points the abscissa is between, starting from the
+    // interval of the previous evaluation.
+    const int k = _interval.find(n, aX, [this](int i) { return _x[i]; });
 
     return _b[k];
 }
@@ -30,6 +30,7 @@
 #include "Array.h"
 #include "PropertyDblArray.h"
 #include "Function.h"
+#include "IntervalHint.h"
 
 
 //=============================================================================
@@ -64,6 +65,8 @@ protected:
 
 private:
     Array<double> _b;
+    /** Knot interval of the last evaluation. */
+    IntervalHint _interval;
 
 //=============================================================================
 // METHODS
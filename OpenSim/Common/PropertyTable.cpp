@@ -145,8 +145,7 @@ updAbstractPropertyByName(const std::string& name) {
 // This method is reused in the implementation of any method that
 // takes a property by name.
 int PropertyTable::findPropertyIndex(const std::string& name) const {
-    const std::map<std::string, int>::const_iterator 
-        it = propertyIndex.find(name);
+    const auto it = propertyIndex.find(name);
     return it == propertyIndex.end() ? -1 : it->second;
 }
 
@@ -27,7 +27,7 @@
 #include "osimCommonDLL.h"
 #include "Property.h"
 
-#include <map>
+#include <unordered_map>
 
 namespace OpenSim {
 
@@ -173,7 +173,8 @@ private:
     // The properties, in the order they were added.
     SimTK::Array_<AbstractProperty*>    properties;
     // A mapping from property name to its index in the properties array.
-    std::map<std::string, int>          propertyIndex;
+    // Every element read from XML is looked up here, so it is hashed.
+    std::unordered_map<std::string, int> propertyIndex;
 
 //==============================================================================
 };  // END of class PropertyTable
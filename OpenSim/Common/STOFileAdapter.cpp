@@ -20,12 +20,13 @@
  * -------------------------------------------------------------------------- */
 
 #include "STOFileAdapter.h"
+#include "IO.h"
 
 namespace OpenSim {
 
 std::shared_ptr<DataAdapter> 
 createSTOFileAdapterForReading(const std::string& fileName) {
-    std::ifstream file{fileName};
+    std::ifstream file{IO::resolvePath(fileName)};
 
     std::regex keyvalue{R"((.*)=(.*))"};
     std::string line{};
@@ -30,6 +30,7 @@
 #include "Array.h"
 #include "PropertyDblArray.h"
 #include "Function.h"
+#include "IntervalHint.h"
 
 
 //=============================================================================
@@ -68,6 +69,8 @@ private:
     Array<double> _b;
     Array<double> _c;
     Array<double> _d;
+    /** Knot interval of the last evaluation. */
+    IntervalHint _interval;
 
 //=============================================================================
 // METHODS
@@ -47,7 +47,7 @@ TRCFileAdapter::extendRead(const std::string& fileName) const {
     OPENSIM_THROW_IF(fileName.empty(),
                      EmptyFileName);
 
-    std::ifstream in_stream{fileName};
+    std::ifstream in_stream{IO::resolvePath(fileName)};
     OPENSIM_THROW_IF(!in_stream.good(),
                      FileDoesNotExist,
                      fileName);
@@ -242,7 +242,7 @@ TRCFileAdapter::extendWrite(const InputTables& absTables,
     OPENSIM_THROW_IF(fileName.empty(),
                      EmptyFileName);
 
-    std::ofstream out_stream{fileName};
+    std::ofstream out_stream{IO::resolvePath(fileName)};
 
     // First line of the stream is the header.
     try {
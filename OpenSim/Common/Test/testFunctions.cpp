@@ -24,6 +24,10 @@
 #include <OpenSim/Common/Sine.h>
 #include <OpenSim/Common/SignalGenerator.h>
 #include <OpenSim/Common/Reporter.h>
+#include <OpenSim/Common/SimmSpline.h>
+#include <OpenSim/Common/PiecewiseLinearFunction.h>
+
+#include <random>
 
 #include "ComponentsForTesting.h"
 
@@ -74,9 +78,61 @@ void testSignalGenerator() {
     }
 }
 
+// Evaluate f at each of the abscissae in order and compare with a copy of f
+// that has not been evaluated before (and so cannot reuse the interval of a
+// previous evaluation).
+void compareWithFreshCopies(const Function& f, const std::vector<double>& xs) {
+    std::vector<int> first{0}, second{0, 0};
+    for (double x : xs) {
+        const Vector arg(1, x);
+        std::unique_ptr<Function> fresh(f.clone());
+        SimTK_TEST_EQ(f.calcValue(arg), fresh->calcValue(arg));
+        fresh.reset(f.clone());
+        SimTK_TEST_EQ(f.calcDerivative(first, arg),
+                      fresh->calcDerivative(first, arg));
+        if (f.getMaxDerivativeOrder() > 1) {
+            fresh.reset(f.clone());
+            SimTK_TEST_EQ(f.calcDerivative(second, arg),
+                          fresh->calcDerivative(second, arg));
+        }
+    }
+}
+
+void testIntervalLookup() {
+    // Unevenly spaced knots.
+    const int n = 40;
+    double x[n], y[n];
+    for (int i = 0; i < n; ++i) {
+        x[i] = 0.05 * i + 0.01 * (i % 3);
+        y[i] = std::sin(3 * x[i]);
+    }
+    SimmSpline spline(n, x, y);
+    PiecewiseLinearFunction linear(n, x, y);
+
+    // Forward, backward, skipping several intervals, out of range and on the
+    // knots themselves.
+    std::vector<double> xs;
+    for (double t = -0.1; t < 2.2; t += 0.013) xs.push_back(t);
+    for (double t = 2.2; t > -0.1; t -= 0.017) xs.push_back(t);
+    for (int i = 0; i < n; ++i) xs.push_back(x[i]);
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<double> distribution(-0.2, 2.2);
+    for (int i = 0; i < 200; ++i) xs.push_back(distribution(generator));
+
+    compareWithFreshCopies(spline, xs);
+    compareWithFreshCopies(linear, xs);
+
+    // The linear function interpolates between the knots.
+    for (int i = 0; i < n - 1; ++i) {
+        const double mid = 0.5 * (x[i] + x[i + 1]);
+        SimTK_TEST_EQ(linear.calcValue(Vector(1, mid)), 0.5 * (y[i] + y[i + 1]));
+    }
+}
+
 int main() {
 
     SimTK_START_TEST("testSignalGenerator");
         SimTK_SUBTEST(testSignalGenerator);
+        SimTK_SUBTEST(testIntervalLookup);
     SimTK_END_TEST();
 }
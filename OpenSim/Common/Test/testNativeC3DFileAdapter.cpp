@@ -0,0 +1,160 @@
+/* -------------------------------------------------------------------------- *
+ *                   OpenSim:  testNativeC3DFileAdapter.cpp                   *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2019 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "OpenSim/Common/NativeC3DFileAdapter.h"
+#include "OpenSim/Common/TRCFileAdapter.h"
+#include <OpenSim/Auxiliary/auxiliaryTestFunctions.h>
+
+#include <ctime>
+
+using namespace OpenSim;
+using namespace std;
+
+template<typename ETY = SimTK::Real>
+void downsample_table(TimeSeriesTable_<ETY>& table,
+                      const unsigned int increment) {
+    for (size_t r = table.getNumRows() - 2; r > 0; --r) {
+        if (r%increment)
+            table.removeRowAtIndex(r);
+    }
+}
+
+bool same(double a, double b) {
+    return a == b || (SimTK::isNaN(a) && SimTK::isNaN(b));
+}
+bool same(const SimTK::Vec3& a, const SimTK::Vec3& b) {
+    return same(a[0], b[0]) && same(a[1], b[1]) && same(a[2], b[2]);
+}
+
+// Compare a table with the rows [firstRow, firstRow + table.getNumRows()) of
+// the columns of `full` that have the same labels.
+template<typename ETY>
+void compare_with_slice(const TimeSeriesTable_<ETY>& table,
+                        const TimeSeriesTable_<ETY>& full, int firstRow) {
+    const auto& times = table.getIndependentColumn();
+    const auto& fullTimes = full.getIndependentColumn();
+    for (const auto& label : table.getColumnLabels()) {
+        const auto column = table.getDependentColumn(label);
+        const auto fullColumn = full.getDependentColumn(label);
+        for (int r = 0; r < column.size(); ++r) {
+            ASSERT_EQUAL(fullTimes[firstRow + r], times[r], 1e-12,
+                         __FILE__, __LINE__, "Times of the slice differ.");
+            ASSERT(same(fullColumn[firstRow + r], column[r]),
+                   __FILE__, __LINE__, "Column '" + label +
+                   "' differs at row " + to_string(r) + ".");
+        }
+    }
+}
+
+void testMarkers(const string& filename) {
+    std::clock_t startTime = std::clock();
+    auto tables = NativeC3DFileAdapter{}.read(filename);
+    cout << "\tNativeC3DFileAdapter '" << filename << "' loaded in "
+         << 1.e3*(std::clock() - startTime) / CLOCKS_PER_SEC << "ms" << endl;
+
+    auto marker_table = std::static_pointer_cast<TimeSeriesTableVec3>(
+            tables.at("markers"));
+    ASSERT(marker_table->getNumRows() > 0, __FILE__, __LINE__,
+           "Failed to read marker data from " + filename);
+    ASSERT(marker_table->getTableMetaData()
+                   .getValueForKey("Units").getValue<string>() == "mm");
+
+    // The markers match those read by the BTK-based C3DFileAdapter.
+    downsample_table(*marker_table, 10);
+    const string base = filename.substr(0, filename.rfind("."));
+    const string marker_file = "native_" + base + "_markers.trc";
+    TRCFileAdapter trc_adapter{};
+    trc_adapter.write(*marker_table, marker_file);
+
+    auto markers = TRCFileAdapter::readFile(marker_file);
+    auto std_markers =
+            TRCFileAdapter::readFile("std_" + base + "_markers.trc");
+    ASSERT(markers.getColumnLabels() == std_markers.getColumnLabels());
+    ASSERT(markers.getNumRows() == std_markers.getNumRows());
+    // Note std exported from Mokka with only 5 decimal places.
+    const auto& matrix = markers.getMatrix();
+    const auto& std_matrix = std_markers.getMatrix();
+    for (int r = 0; r < matrix.nrow(); ++r)
+        for (int c = 0; c < matrix.ncol(); ++c)
+            ASSERT_EQUAL(std_matrix(r, c), matrix(r, c), 1e-4,
+                         __FILE__, __LINE__,
+                         "Marker data differs from the standard at row " +
+                         to_string(r) + ", col " + to_string(c) + ".");
+    cout << "\tMarkers " << marker_file << " equivalent to standard." << endl;
+}
+
+void testSelection(const string& filename) {
+    const auto full = NativeC3DFileAdapter::readMarkers(filename);
+    const auto& labels = full.getColumnLabels();
+
+    // A subset of the markers, in a different order, over part of the trial.
+    const vector<string> names{labels[3], labels[0]};
+    const auto part = NativeC3DFileAdapter::readMarkers(filename, names,
+                                                        0.5, 1.0);
+    ASSERT(part.getColumnLabels() == names);
+    ASSERT(part.getNumRows() == 126); // 250 Hz for 0.5 s, both ends included.
+    compare_with_slice(part, full, 125);
+
+    ASSERT_THROW(Exception,
+            NativeC3DFileAdapter::readMarkers(filename, {"not_a_marker"}));
+
+    // Analog channels are sampled 8 times per frame.
+    const auto analogs = NativeC3DFileAdapter::readAnalogs(filename);
+    ASSERT(analogs.getNumColumns() == 12);
+    ASSERT(analogs.getNumRows() == 8*full.getNumRows());
+    ASSERT(analogs.getColumnLabels()[0] == "Fx1");
+    ASSERT_EQUAL(1./2000, analogs.getIndependentColumn()[1], 1e-12);
+    const auto& units = analogs.getDependentsMetaData()
+            .getValueArrayForKey("units");
+    ASSERT(units[0].getValue<string>() == "N");
+    ASSERT(units[3].getValue<string>() == "Nmm");
+
+    NativeC3DFileAdapter adapter{};
+    adapter.setAnalogChannelNames({"Fz2", "Fz1"});
+    adapter.setTimeRange(1.0, 2.0);
+    adapter.setReadMarkers(false);
+    auto tables = adapter.read(filename);
+    ASSERT(tables.count("markers") == 0);
+    const auto forces = std::static_pointer_cast<TimeSeriesTable>(
+            tables.at("analogs"));
+    ASSERT(forces->getNumColumns() == 2);
+    ASSERT(forces->getNumRows() == 8*251);
+    compare_with_slice(*forces, analogs, 8*250);
+}
+
+int main() {
+    for (const string filename : {"walking2.c3d", "walking5.c3d"}) {
+        cout << "\nTest reading '" + filename + "'." << endl;
+        try {
+            testMarkers(filename);
+            testSelection(filename);
+        }
+        catch (const std::exception& ex) {
+            cout << "testNativeC3DFileAdapter FAILED: " << ex.what() << endl;
+            return 1;
+        }
+    }
+
+    cout << "\nAll testNativeC3DFileAdapter cases passed." << endl;
+
+    return 0;
+}
@@ -21,6 +21,8 @@
  * -------------------------------------------------------------------------- */
 
 #include <fstream>
+#include <thread>
+#include <OpenSim/Common/IO.h>
 #include <OpenSim/Common/Storage.h>
 #include <OpenSim/Auxiliary/auxiliaryTestFunctions.h>
 #include <OpenSim/Common/STOFileAdapter.h>
@@ -170,6 +172,57 @@ void testStorageGetStateIndexBackwardsCompatibility() {
     // TODO: Put XML document version in Storage header.
 }
 
+void testStorageWithBaseDirectory() {
+    // Files are read and written relative to the base directory of the
+    // calling thread, and the working directory of the process is unchanged.
+    const std::string cwd = IO::getCwd();
+    const std::string dirName = "testStorageBaseDirectory";
+    IO::makeDir(dirName);
+    const Storage original("test.sto");
+    const int precision = IO::GetPrecision();
+
+    // Each thread keeps its own base directory and number format. Results
+    // are checked after joining, since ASSERT throws.
+    int sizes[2] = {0, 0};
+    int precisions[2] = {0, 0};
+    auto writeAndRead = [&](int i, int threadPrecision) {
+        ScopedBaseDirectory directoryOfOutput(dirName);
+        IO::SetPrecision(threadPrecision);
+        const std::string fileName = "copy" + std::to_string(i + 1) + ".sto";
+        original.print(fileName);
+        Storage copy(fileName);
+        sizes[i] = copy.getSize();
+        precisions[i] = IO::GetPrecision();
+    };
+    std::thread thread1(writeAndRead, 0, 4);
+    std::thread thread2(writeAndRead, 1, 12);
+    thread1.join();
+    thread2.join();
+
+    ASSERT(sizes[0] == original.getSize() && sizes[1] == original.getSize());
+    ASSERT(precisions[0] == 4 && precisions[1] == 12);
+    ASSERT(IO::FileExists(dirName + "/copy1.sto"));
+    ASSERT(IO::FileExists(dirName + "/copy2.sto"));
+    ASSERT(!IO::FileExists("copy1.sto"));
+    ASSERT(IO::getCwd() == cwd);
+    ASSERT(IO::GetPrecision() == precision);
+    ASSERT(IO::getBaseDirectory().empty());
+
+    // Scopes nest, and a relative base directory is resolved against the
+    // enclosing one.
+    {
+        ScopedBaseDirectory outer(dirName);
+        ASSERT(IO::isAbsolutePath(IO::getBaseDirectory()));
+        {
+            ScopedBaseDirectory inner(".");
+            ASSERT(IO::FileExists("copy1.sto"));
+        }
+        ASSERT(IO::resolvePath("copy1.sto") ==
+               IO::getBaseDirectory() + "/copy1.sto");
+    }
+    ASSERT(IO::getBaseDirectory().empty());
+}
+
 int main() {
     SimTK_START_TEST("testStorage");
 
@@ -194,6 +247,8 @@ int main() {
         SimTK_SUBTEST(testStorageLegacy);
 
         SimTK_SUBTEST(testStorageGetStateIndexBackwardsCompatibility);
+
+        SimTK_SUBTEST(testStorageWithBaseDirectory);
     SimTK_END_TEST();
 }
 
@@ -31,6 +31,7 @@
 //-----------------------------------------------------------------------------
 #include "XMLDocument.h"
 #include "Object.h"
+#include "IO.h"
 #include <functional>
 
 
@@ -112,11 +113,11 @@ XMLDocument::XMLDocument()
  * @param aFileName File name of the XML document.
  */
 XMLDocument::XMLDocument(const string &aFileName) :
-SimTK::Xml::Document(aFileName)
+SimTK::Xml::Document(IO::resolvePath(aFileName))
 {
-
-
-    _fileName = aFileName;
+    // Keep the name of the file that was read, so that the files that the
+    // document refers to are found relative to it on any thread.
+    _fileName = IO::resolvePath(aFileName);
 
     // Update document version based on parsing
     updateDocumentVersion();
@@ -184,7 +185,7 @@ print(const string &aFileName)
     // File
     } else {
         setIndentString("\t");
-        writeToFile(aFileName);
+        writeToFile(IO::resolvePath(aFileName));
     }
     return true;
 }
@@ -2,6 +2,7 @@
 #include "Simbody.h"
 #include "Exception.h"
 #include "FileAdapter.h"
+#include "IO.h"
 #include "TimeSeriesTable.h"
 #include "XsensDataReader.h"
 
@@ -40,7 +41,7 @@ XsensDataReader::extendRead(const std::string& folderName) const {
         std::string prefix = _settings.get_trial_prefix();
         const ExperimentalSensor& nextItem = _settings.get_ExperimentalSensors(index);
         auto fileName = folderName + prefix + nextItem.getName() +".txt";
-        auto* nextStream = new std::ifstream{ fileName };
+        auto* nextStream = new std::ifstream{ IO::resolvePath(fileName) };
         OPENSIM_THROW_IF(!nextStream->good(),
             FileDoesNotExist,
             fileName);
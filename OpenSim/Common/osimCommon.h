@@ -61,6 +61,8 @@
 
 #include "Reporter.h"
 
+#include "ComponentProfiler.h"
+
 #include "ModelDisplayHints.h"
 
 #endif // OPENSIM_OSIMCOMMON_H_
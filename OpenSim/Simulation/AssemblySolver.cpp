@@ -26,6 +26,8 @@
 #include <OpenSim/Common/Constant.h>
 #include "simbody/internal/AssemblyCondition_QValue.h"
 
+#include <chrono>
+
 using namespace std;
 using namespace SimTK;
 
@@ -71,6 +73,23 @@ AssemblySolver::AssemblySolver
     }
 }
 
+void AssemblySolver::setTrackingExtrapolationOrder(int order)
+{
+    OPENSIM_THROW_IF(order < 0 || order > 2, Exception,
+        "Expected a tracking extrapolation order of 0, 1 or 2, but got " +
+        std::to_string(order) + ".");
+    _trackingExtrapolationOrder = order;
+}
+
+void AssemblySolver::setTrackingTimeBudget(double seconds)
+{
+    OPENSIM_THROW_IF(!(seconds > 0), Exception,
+        "Expected a positive tracking time budget, but got " +
+        std::to_string(seconds) + ".");
+    _trackingTimeBudget = seconds;
+    _refinementTime = 0;
+}
+
 void AssemblySolver::setAccuracy(double accuracy)
 {
     _accuracy = accuracy;
@@ -209,6 +228,9 @@ void AssemblySolver::assemble(SimTK::State &state)
         _assembler->assemble();
         // Update the q's in the state passed in
         _assembler->updateFromInternalState(s);
+        _trackedSolutions.clear();
+        _trackedSolutions.emplace_back(s.getTime(),
+                _assembler->getFreeQsFromInternalState());
         state.updQ() = s.getQ();
         state.updU() = s.getU();
 
@@ -269,11 +291,48 @@ void AssemblySolver::track(SimTK::State &s)
     */
 
     try{
+        using Clock = std::chrono::steady_clock;
+        const Clock::time_point start = Clock::now();
+        const int numGoalEvals = _assembler->getNumGoalEvals();
+        extrapolateFreeQs(s.getTime());
+
         // Now do the assembly and return the updated state.
-        _assembler->track(s.getTime());
+        _trackingStats.converged = true;
+        if (_trackingTimeBudget < SimTK::Infinity) {
+            _assembler->setAccuracy(std::sqrt(_accuracy));
+            _assembler->track(s.getTime());
+            _assembler->setAccuracy(_accuracy);
+
+            const Clock::time_point coarse = Clock::now();
+            const double elapsed =
+                std::chrono::duration<double>(coarse - start).count();
+            if (elapsed + _refinementTime <= _trackingTimeBudget) {
+                _assembler->track(s.getTime());
+                _refinementTime = std::chrono::duration<double>(
+                        Clock::now() - coarse).count();
+            } else {
+                // Let the estimate decay so that refining is tried again.
+                _refinementTime *= 0.9;
+                _trackingStats.converged = false;
+            }
+        } else {
+            _assembler->track(s.getTime());
+        }
 
         // update the state from the result of the assembler 
         _assembler->updateFromInternalState(s);
+
+        _trackedSolutions.emplace_back(s.getTime(),
+                _assembler->getFreeQsFromInternalState());
+        if (_trackedSolutions.size() > 3)
+            _trackedSolutions.erase(_trackedSolutions.begin());
+
+        _trackingStats.numGoalEvaluations =
+                _assembler->getNumGoalEvals() - numGoalEvals;
+        _trackingStats.goal = _assembler->calcCurrentGoal();
+        _trackingStats.errorNorm = _assembler->calcCurrentErrorNorm();
+        _trackingStats.time =
+                std::chrono::duration<double>(Clock::now() - start).count();
         
         /* TODO: Useful to include through debug message/log in the future
         printf("Tracking: t= %f (acc=%g tol=%g normerr=%g, maxerr=%g, cost=%g)\n", 
@@ -290,6 +349,34 @@ void AssemblySolver::track(SimTK::State &s)
     }
 }
 
+/* Use the Lagrange polynomial through the last solutions, which are only
+   used if they are for increasing times before t and for the same free q's. */
+void AssemblySolver::extrapolateFreeQs(double t)
+{
+    const int numPoints =
+        std::min(_trackingExtrapolationOrder + 1, (int)_trackedSolutions.size());
+    if (numPoints < 2) return;
+
+    const auto first = _trackedSolutions.end() - numPoints;
+    for (auto p = first; p != _trackedSolutions.end(); ++p) {
+        const double next =
+            p + 1 == _trackedSolutions.end() ? t : (p + 1)->first;
+        if (!(p->first < next) ||
+                p->second.size() != _assembler->getNumFreeQs())
+            return;
+    }
+
+    SimTK::Vector freeQs(_assembler->getNumFreeQs(), 0.0);
+    for (auto p = first; p != _trackedSolutions.end(); ++p) {
+        double weight = 1;
+        for (auto other = first; other != _trackedSolutions.end(); ++other)
+            if (other != p)
+                weight *= (t - other->first) / (p->first - other->first);
+        freeQs += weight * p->second;
+    }
+    _assembler->setInternalStateFromFreeQs(freeQs);
+}
+
 const SimTK::Assembler& AssemblySolver::getAssembler() const
 {
     OPENSIM_THROW_IF(!_assembler, Exception,
@@ -118,6 +118,52 @@ public:
     /** Read access to the underlying SimTK::Assembler. */
     const SimTK::Assembler& getAssembler() const;
 
+    /** @name Tracking
+    For streaming and real-time use, track() can start from an
+    extrapolation of the previous solutions and can be given a time budget
+    per frame, trading accuracy for a predictable cost. Neither is used by
+    default. */
+    /// @{
+
+    /** Statistics of the last call to track(). */
+    struct TrackingStats {
+        /** Wall-clock time spent in track(), in seconds. */
+        double time = SimTK::NaN;
+        /** Number of evaluations of the assembly goal, which grows with the
+            number of iterations of the underlying optimizer. */
+        int numGoalEvaluations = 0;
+        /** Value of the assembly goal at the solution. */
+        double goal = SimTK::NaN;
+        /** Norm of the constraint errors at the solution. */
+        double errorNorm = SimTK::NaN;
+        /** Whether the solution was resolved to the accuracy of the solver
+            rather than only to the coarse accuracy of a budgeted frame. */
+        bool converged = false;
+    };
+
+    /** %Set the order of the polynomial through the solutions of the
+        previous calls to track() that provides the initial guess of the next
+        call: 0 (default) starts from the previous solution, 1 from a linear
+        and 2 from a quadratic extrapolation in time. Extrapolation starts
+        once enough frames have been tracked since assemble(), and is skipped
+        if time does not increase. */
+    void setTrackingExtrapolationOrder(int order);
+    int getTrackingExtrapolationOrder() const
+    {   return _trackingExtrapolationOrder; }
+
+    /** %Set the wall-clock time (seconds) that each call to track() should
+        take at most. With a finite budget, track() first solves to a coarse
+        accuracy (the square root of the accuracy of the solver) and then
+        refines the solution to the accuracy of the solver only if the
+        previous refinement would fit in the rest of the budget. The
+        default, Infinity, always solves to the accuracy of the solver. */
+    void setTrackingTimeBudget(double seconds);
+    double getTrackingTimeBudget() const { return _trackingTimeBudget; }
+
+    /** The statistics of the last call to track(). */
+    const TrackingStats& getTrackingStats() const { return _trackingStats; }
+    /// @}
+
 protected:
     /** Internal method to convert the CoordinateReferences into goals of the 
         assembly solver. Subclasses, can add and override to include other goals  
@@ -147,6 +193,20 @@ private:
     SimTK::ResetOnCopy< std::unique_ptr<SimTK::Assembler>> _assembler;
 
     SimTK::Array_<SimTK::QValue*> _coordinateAssemblyConditions;
+
+    /** Initialize the Assembler's free q's by extrapolating the previous
+        solutions to time t. */
+    void extrapolateFreeQs(double t);
+
+    int _trackingExtrapolationOrder{0};
+    double _trackingTimeBudget{SimTK::Infinity};
+    TrackingStats _trackingStats;
+
+    // Times and free q's of the last solutions of track(), oldest first.
+    SimTK::ResetOnCopy<std::vector<std::pair<double, SimTK::Vector>>>
+        _trackedSolutions;
+    // Estimated time of the refinement of a budgeted frame.
+    double _refinementTime{0.0};
 //=============================================================================
 };  // END of class AssemblySolver
 //=============================================================================
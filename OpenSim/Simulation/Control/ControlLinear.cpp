@@ -417,7 +417,8 @@ setControlValue(ArrayPtrs<ControlLinearNode> &aNodes,double aT,double aValue)
 }
 
 double ControlLinear::
-getControlValue(ArrayPtrs<ControlLinearNode> &aNodes,double aT)
+getControlValue(ArrayPtrs<ControlLinearNode> &aNodes,double aT,
+        const IntervalHint& aHint)
 {
     // CHECK SIZE
     int size = aNodes.getSize();
@@ -425,8 +426,17 @@ getControlValue(ArrayPtrs<ControlLinearNode> &aNodes,double aT)
     if(size<=0) return(SimTK::NaN);
 
     // GET NODE
-    _searchNode.setTime(aT);
-    int i = aNodes.searchBinary(_searchNode);
+    // i is the last node at or before aT, as ArrayPtrs::searchBinary() would
+    // return, but starts from the interval of the previous call.
+    int i;
+    if(aT < aNodes[0]->getTime()) {
+        i = -1;
+    } else if(aT >= aNodes.getLast()->getTime()) {
+        i = size - 1;
+    } else {
+        i = aHint.find(size, aT,
+                [&aNodes](int k) { return aNodes[k]->getTime(); });
+    }
 
     // BEFORE FIRST
     double value;
@@ -525,7 +535,7 @@ setControlValue(double aT,double aX)
 double ControlLinear::
 getControlValue(double aT)
 {
-    return getControlValue(_xNodes,aT);
+    return getControlValue(_xNodes,aT,_xHint);
 }
 //_____________________________________________________________________________
 double ControlLinear::
@@ -556,7 +566,7 @@ getControlValueMin(double aT)
     if(_minNodes.getSize()==0)
         return _defaultMin;
     else
-        return getControlValue(_minNodes,aT);
+        return getControlValue(_minNodes,aT,_minHint);
 }
 //_____________________________________________________________________________
 double ControlLinear::
@@ -588,7 +598,7 @@ getControlValueMax(double aT)
     if(_minNodes.getSize()==0)
         return _defaultMax;
     else
-        return getControlValue(_maxNodes,aT);
+        return getControlValue(_maxNodes,aT,_maxHint);
 }
 //_____________________________________________________________________________
 double ControlLinear::
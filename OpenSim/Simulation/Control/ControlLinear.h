@@ -32,6 +32,7 @@
 #include <OpenSim/Simulation/osimSimulationDLL.h>
 #include <OpenSim/Common/PropertyBool.h>
 #include <OpenSim/Common/PropertyObjArray.h>
+#include <OpenSim/Common/IntervalHint.h>
 #include "Control.h"
 #include "ControlLinearNode.h"
 
@@ -90,6 +91,13 @@ protected:
     a node up front, and then just alter the time. */
     ControlLinearNode _searchNode;
 
+    /** Node intervals of the last lookups into _xNodes, _minNodes and
+    _maxNodes, which make getControlValue() O(1) when it is called with
+    increasing (or nearby) times. */
+    IntervalHint _xHint;
+    IntervalHint _minHint;
+    IntervalHint _maxHint;
+
 //=============================================================================
 // METHODS
 //=============================================================================
@@ -383,7 +391,8 @@ public:
 
 private:
     void setControlValue(ArrayPtrs<ControlLinearNode> &aNodes,double aT,double aX);
-    double getControlValue(ArrayPtrs<ControlLinearNode> &aNodes,double aT);
+    double getControlValue(ArrayPtrs<ControlLinearNode> &aNodes,double aT,
+            const IntervalHint& aHint);
     double extrapolateBefore(const ArrayPtrs<ControlLinearNode> &aNodes,double aT) const;
     double extrapolateAfter(ArrayPtrs<ControlLinearNode> &aNodes,double aT) const;
 
@@ -91,6 +91,8 @@ void ControlSetController::setNull()
 
     _model = NULL;
     _controlSet = NULL;
+    _indexedControlSet = NULL;
+    _indexedControlSetSize = -1;
 
 
 }
@@ -162,24 +164,47 @@ void ControlSetController::computeControls(const SimTK::State& s, SimTK::Vector&
 {
     SimTK_ASSERT( _controlSet , "ControlSetController::computeControls controlSet is NULL");
 
-    std::string actName = "";
-    int index = -1;
+    updateControlIndices();
 
     int na = getActuatorSet().getSize();
+    SimTK::Vector actControls(1);
 
     for(int i=0; i< na; ++i){
-        actName = getActuatorSet()[i].getName();
-        index = _controlSet->getIndex(actName);
+        int index = _controlIndices[i];
+        if(index >= 0){
+            actControls[0] = _controlSet->get(index).getControlValue(s.getTime());
+            getActuatorSet()[i].addInControls(actControls, controls);
+        }
+    }
+}
+
+//_____________________________________________________________________________
+/**
+ * Look up the control of each actuator in the ControlSet, by the actuator
+ * name or by the actuator name followed by ".excitation". The lookup is
+ * skipped if the ControlSet and the actuators have not changed since the
+ * last call.
+ */
+void ControlSetController::updateControlIndices() const
+{
+    int na = getActuatorSet().getSize();
+    if(_indexedControlSet == _controlSet &&
+            _indexedControlSetSize == _controlSet->getSize() &&
+            (int)_controlIndices.size() == na)
+        return;
+
+    _controlIndices.assign(na, -1);
+    for(int i=0; i< na; ++i){
+        std::string actName = getActuatorSet()[i].getName();
+        int index = _controlSet->getIndex(actName);
         if(index < 0){
             actName = actName + ".excitation";
             index = _controlSet->getIndex(actName);
         }
-
-        if(index >= 0){
-            SimTK::Vector actControls(1, _controlSet->get(index).getControlValue(s.getTime()));
-            getActuatorSet()[i].addInControls(actControls, controls);
-        }
+        _controlIndices[i] = index;
     }
+    _indexedControlSet = _controlSet;
+    _indexedControlSetSize = _controlSet->getSize();
 }
 
 double ControlSetController::getFirstTime() const {
@@ -257,6 +282,9 @@ void ControlSetController::extendFinalizeFromProperties()
         delete _controlSet;
     }
 
+    // The actuators, and possibly the ControlSet, change here.
+    _indexedControlSet = nullptr;
+
     if (loadedControlSet) {
         // Now set the current control set from what was loaded
         _controlSet = loadedControlSet;
@@ -57,6 +57,16 @@ protected:
     PropertyStr _controlsFileNameProp;
     std::string &_controlsFileName;
 
+private:
+    /** Index into _controlSet of the control of each actuator, or -1 if the
+    actuator has no control. Resolved by name once per ControlSet (and again
+    if its size changes) rather than at every call to computeControls(). */
+    mutable std::vector<int> _controlIndices;
+    mutable const ControlSet* _indexedControlSet;
+    mutable int _indexedControlSetSize;
+
+protected:
+
 //=============================================================================
 // METHODS
 //=============================================================================
@@ -92,6 +102,7 @@ private:
     // and not even by subclasses of this class.
 
     void setNull();
+    void updateControlIndices() const;
 
 protected:
 
@@ -259,6 +259,33 @@ void InverseKinematicsSolver::
                     findCurrentMarkerErrorSquared(SimTK::Markers::MarkerIx(i));
 }
 
+/* Compute the locations of all markers and their squared errors, evaluating
+   each marker location only once. */
+void InverseKinematicsSolver::computeCurrentMarkerLocationsAndSquaredErrors(
+        SimTK::Array_<SimTK::Vec3>& markerLocations,
+        SimTK::Array_<double>& squaredMarkerErrors)
+{
+    const int nm = _markerAssemblyCondition->getNumMarkers();
+    markerLocations.resize(nm);
+    squaredMarkerErrors.resize(nm);
+    for (int i = 0; i < nm; ++i) {
+        const SimTK::Markers::MarkerIx mx(i);
+        markerLocations[i] =
+                _markerAssemblyCondition->findCurrentMarkerLocation(mx);
+        // As in Markers::findCurrentMarkerErrorSquared(), a marker without a
+        // (finite) observation has no error.
+        const SimTK::Markers::ObservationIx ox =
+                _markerAssemblyCondition->getObservationIxForMarker(mx);
+        if (!ox.isValid()) {
+            squaredMarkerErrors[i] = 0;
+            continue;
+        }
+        const SimTK::Vec3& observed = _markerAssemblyCondition->getObservation(ox);
+        squaredMarkerErrors[i] = observed.isFinite() ?
+                (markerLocations[i] - observed).normSqr() : 0;
+    }
+}
+
 /* Marker errors are reported in order different from tasks file or model, find name corresponding to passed in index  */
 std::string InverseKinematicsSolver::getMarkerNameForIndex(int markerIndex) const
 {
@@ -171,6 +171,16 @@ public:
         returned by computeCurrentMarkerErrors(). */
     void computeCurrentSquaredMarkerErrors(SimTK::Array_<double> &markerErrors);
 
+    /** Compute the spatial locations of all model markers in ground and their
+        squared-distance errors to the observations together. Each marker
+        location is evaluated once, whereas calling both
+        computeCurrentMarkerLocations() and computeCurrentSquaredMarkerErrors()
+        evaluates it twice. The arrays are only reallocated if their size is
+        not the number of markers in use, so they can be reused every frame. */
+    void computeCurrentMarkerLocationsAndSquaredErrors(
+            SimTK::Array_<SimTK::Vec3>& markerLocations,
+            SimTK::Array_<double>& squaredMarkerErrors);
+
     /** Marker locations and errors may be computed in an order that is different
         from tasks file or listed in the model. Return the corresponding marker
         name for an index in the list of marker locations/errors returned by the
@@ -30,6 +30,7 @@
 #include <OpenSim/Simulation/Model/AnalysisSet.h>
 #include <OpenSim/Simulation/Model/ControllerSet.h>
 #include <OpenSim/Common/Array.h>
+#include <OpenSim/Common/IO.h>
 
 
 using namespace OpenSim;
@@ -333,7 +334,7 @@ printDTArray(const char *aFileName)
     if(aFileName==NULL) {
         fp = stdout;
     } else {
-        fp = fopen(aFileName,"w");
+        fp = fopen(IO::resolvePath(aFileName).c_str(),"w");
         if(fp==NULL) {
             printf("Manager.printDTArray: unable to print to file %s.\n",
                 aFileName);
@@ -428,7 +429,7 @@ printTimeArray(const char *aFileName)
     if(aFileName==NULL) {
         fp = stdout;
     } else {
-        fp = fopen(aFileName,"w");
+        fp = fopen(IO::resolvePath(aFileName).c_str(),"w");
         if(fp==NULL) {
             printf("Manager.printTimeArray: unable to print to file %s.\n",
                 aFileName);
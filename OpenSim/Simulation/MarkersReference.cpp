@@ -23,6 +23,7 @@
 
 #include "MarkersReference.h"
 #include <SimTKcommon/internal/State.h>
+#include <algorithm>
 #include <cmath>
 
 using namespace std;
@@ -110,6 +111,7 @@ populateFromMarkerData(const TimeSeriesTable_<SimTK::Vec3>& markerTable,
     for(unsigned i = 0; i < markerNames.size(); ++i) {
         _markerNames[i] = markerNames[i];
     }
+    _cursor = 0;
 
     // Names must be assigned before weights can be updated
     updateInternalWeights();
@@ -137,11 +139,119 @@ const SimTK::Array_<std::string>& MarkersReference::getNames() const {
 
 void MarkersReference::getValues(const SimTK::State& s,
                                   SimTK::Array_<Vec3>& values) const {
-    double time = s.getTime();
-    const auto rowView = _markerTable.getNearestRow(time);
-    values.clear();
-    for(int i = 0; i < rowView.ncol(); ++i)
-        values.push_back(rowView[i]);
+    getValuesAtTime(s.getTime(), values);
+}
+
+void MarkersReference::getValuesAtTime(double time,
+                                       SimTK::Array_<Vec3>& values) const {
+    const auto& times = _markerTable.getIndependentColumn();
+    OPENSIM_THROW_IF(times.empty(), EmptyTable);
+    OPENSIM_THROW_IF(time < times.front() - SimTK::SignificantReal ||
+                     time > times.back() + SimTK::SignificantReal,
+                     TimeOutOfRange, time, times.front(), times.back());
+
+    const int nm = getNumRefs();
+    values.resize(nm);
+
+    const size_t i = findFrameAtOrBefore(time);
+    const size_t last = times.size() - 1;
+    // Fraction of the interval [times[i], times[i+1]] at which time lies.
+    const double alpha = i < last ?
+            clamp(0.0, (time - times[i]) / (times[i+1] - times[i]), 1.0) : 0;
+
+    if (_interpolation == Nearest || i == last) {
+        const size_t row = (i < last && alpha >= 0.5) ? i + 1 : i;
+        const auto rowView = _markerTable.getRowAtIndex(row);
+        for (int j = 0; j < nm; ++j) {
+            values[j] = rowView[j];
+            if (!values[j].isFinite())
+                values[j] = getSampleOrFillGap(row, j, times[row]);
+        }
+        return;
+    }
+
+    const auto& data = _markerTable.getMatrix();
+    for (int j = 0; j < nm; ++j) {
+        const Vec3 p0 = getSampleOrFillGap(i, j, times[i]);
+        const Vec3 p1 = getSampleOrFillGap(i + 1, j, times[i+1]);
+        if (!p0.isFinite() || !p1.isFinite()) {
+            // Next to a gap that is not filled, use the nearest frame.
+            values[j] = getSampleOrFillGap(alpha < 0.5 ? i : i + 1, j, time);
+            continue;
+        }
+        if (_interpolation == Linear) {
+            values[j] = (1 - alpha)*p0 + alpha*p1;
+            continue;
+        }
+        // Cubic Hermite interpolation with finite-difference tangents,
+        // scaled to the interval [times[i], times[i+1]]. At the ends of the
+        // data or of a gap, the tangent is that of the interval itself.
+        const double dt = times[i+1] - times[i];
+        Vec3 m0 = p1 - p0, m1 = p1 - p0;
+        if (i > 0 && data(int(i) - 1, j).isFinite())
+            m0 = (p1 - data(int(i) - 1, j))*(dt/(times[i+1] - times[i-1]));
+        if (i + 1 < last && data(int(i) + 2, j).isFinite())
+            m1 = (data(int(i) + 2, j) - p0)*(dt/(times[i+2] - times[i]));
+        const double a2 = alpha*alpha, a3 = a2*alpha;
+        values[j] = (2*a3 - 3*a2 + 1)*p0 + (a3 - 2*a2 + alpha)*m0 +
+                    (3*a2 - 2*a3)*p1 + (a3 - a2)*m1;
+    }
+}
+
+SimTK::RowVectorView_<Vec3>
+MarkersReference::getNearestRowView(double time) const {
+    const auto& times = _markerTable.getIndependentColumn();
+    OPENSIM_THROW_IF(times.empty(), EmptyTable);
+    size_t i = findFrameAtOrBefore(time);
+    if (i + 1 < times.size() && (times[i+1] - time) <= (time - times[i]))
+        ++i;
+    return _markerTable.getRowAtIndex(i);
+}
+
+size_t MarkersReference::findFrameAtOrBefore(double time) const {
+    const auto& times = _markerTable.getIndependentColumn();
+    const size_t n = times.size();
+    if (time <= times.front()) return _cursor = 0;
+    if (time >= times.back()) return _cursor = n - 1;
+    // Queries are usually at increasing times, so first look at the frame
+    // of the previous query and the next few frames.
+    size_t i = std::min(_cursor, n - 1);
+    if (times[i] <= time) {
+        for (size_t k = 0; k < 4 && i + 1 < n; ++k, ++i) {
+            if (time < times[i+1]) return _cursor = i;
+        }
+    }
+    // Otherwise, search the whole time column.
+    const auto after = std::upper_bound(times.begin(), times.end(), time);
+    return _cursor = size_t(std::distance(times.begin(), after)) - 1;
+}
+
+Vec3 MarkersReference::getSampleOrFillGap(size_t row, int col,
+                                          double time) const {
+    const auto& times = _markerTable.getIndependentColumn();
+    const auto& data = _markerTable.getMatrix();
+    const Vec3& sample = data(int(row), col);
+    if (sample.isFinite() || !(_maxGapDuration > 0))
+        return sample;
+
+    // Find the valid samples on either side of the gap, looking no further
+    // than the longest gap that is filled.
+    const int nrow = data.nrow();
+    int before = int(row), after = int(row);
+    while (before >= 0 && !data(before, col).isFinite() &&
+           times[row] - times[before] <= _maxGapDuration)
+        --before;
+    while (after < nrow && !data(after, col).isFinite() &&
+           times[after] - times[row] <= _maxGapDuration)
+        ++after;
+    if (before < 0 || after >= nrow ||
+            !data(before, col).isFinite() || !data(after, col).isFinite() ||
+            times[after] - times[before] > _maxGapDuration)
+        return Vec3(SimTK::NaN);
+
+    const double alpha = clamp(0.0,
+            (time - times[before]) / (times[after] - times[before]), 1.0);
+    return (1 - alpha)*data(before, col) + alpha*data(after, col);
 }
 
 // void
@@ -78,10 +78,28 @@ private:
  * the relative importance of achieving one marker's reference relative to
  * another.
  *
+ * By default, the values at a time are those of the frame nearest to that
+ * time. The values can instead be interpolated between frames (see
+ * setInterpolation()), for example to solve inverse kinematics at times that
+ * are not frames of the marker data. Missing samples (NaN) make the marker
+ * be ignored at that time, unless the gap is short enough to be bridged by
+ * linear interpolation (see setMaxGapDuration()). The frame of the previous
+ * query is remembered so that queries at increasing times do not search the
+ * whole time column.
+ *
  * @author Ajay Seth
  */
 class OSIMSIMULATION_API MarkersReference : public Reference_<SimTK::Vec3> {
     OpenSim_DECLARE_CONCRETE_OBJECT(MarkersReference, Reference_<SimTK::Vec3>);
+public:
+    /** How the values between frames of the marker data are obtained. */
+    enum Interpolation {
+        Nearest, ///< Values of the nearest frame (the default).
+        Linear,  ///< Linear interpolation between the two adjacent frames.
+        Cubic    ///< Cubic Hermite interpolation using the two adjacent
+                 ///< frames and one more frame on either side.
+    };
+
 //=============================================================================
 // Properties
 //=============================================================================
@@ -133,9 +151,17 @@ public:
     SimTK::Vec2 getValidTimeRange() const override;
     /** get the names of the markers serving as references */
     const SimTK::Array_<std::string>& getNames() const override;
-    /** get the value of the MarkersReference */
+    /** get the value of the MarkersReference at the time of the state,
+        interpolated according to getInterpolation(). `values` is only
+        reallocated if its size is not the number of markers. */
     void getValues(const SimTK::State &s,
         SimTK::Array_<SimTK::Vec3> &values) const override;
+    /** Same as getValues(), given a time. */
+    void getValuesAtTime(double time,
+                         SimTK::Array_<SimTK::Vec3>& values) const;
+    /** Get a view, without copying, of the frame of the marker data nearest
+        to the given time. Gaps are not filled. */
+    SimTK::RowVectorView_<SimTK::Vec3> getNearestRowView(double time) const;
     // The following two methods are commented out as they are not implemented
     // and we don't want users to think it *is* implemented when viewing
     // doxygen.
@@ -167,12 +193,30 @@ public:
     void setDefaultWeight(double weight);
     size_t getNumFrames() const;
 
+    /** %Set how the values between frames are obtained. */
+    void setInterpolation(Interpolation interpolation)
+    {   _interpolation = interpolation; }
+    Interpolation getInterpolation() const { return _interpolation; }
+    /** Fill gaps (missing samples) in a marker trajectory that last at most
+        `seconds`, from the last valid sample before the gap to the first
+        valid sample after it, by linear interpolation between these samples.
+        Longer gaps are NaN, so the marker is ignored during them. The default
+        is 0 (no gaps are filled). */
+    void setMaxGapDuration(double seconds) { _maxGapDuration = seconds; }
+    double getMaxGapDuration() const { return _maxGapDuration; }
+
 private:
     void constructProperties();
     void
     populateFromMarkerData(const TimeSeriesTable_<SimTK::Vec3>& markerData,
                            const std::string& units);
     void updateInternalWeights() const;
+    // Index of the last frame at or before time (0 if time is before the
+    // first frame), starting the search at the frame of the previous query.
+    size_t findFrameAtOrBefore(double time) const;
+    // Value of marker `col` at `time` in frame `row` or, if it is missing,
+    // interpolated across the gap (NaN if the gap is too long).
+    SimTK::Vec3 getSampleOrFillGap(size_t row, int col, double time) const;
 
     TimeSeriesTable_<SimTK::Vec3> _markerTable;
     // marker names inside the marker data
@@ -180,6 +224,11 @@ private:
     //    TimeSeriesTable_<SimTK::Vec3> _markerTable;
     // List of weights guaranteed to be in the same order as marker names.
     mutable SimTK::Array_<double> _weights;
+
+    Interpolation _interpolation{Nearest};
+    double _maxGapDuration{0};
+    // Frame found by the previous query.
+    mutable size_t _cursor{0};
 //=============================================================================
 };  // END of class MarkersReference
 //=============================================================================
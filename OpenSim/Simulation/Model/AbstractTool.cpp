@@ -386,59 +386,46 @@ loadModel(const string &aToolSetupFileName, ForceSet *rOriginalForceSet )
             "No model file was specified (<model_file> element is empty) in "
             "the Tool's Setup file. Consider passing `false` for the "
             "constructor's `aLoadModel` parameter");
-    string saveWorkingDirectory = IO::getCwd();
-    string directoryOfSetupFile = IO::getParentDirectory(aToolSetupFileName);
-    IO::chDir(directoryOfSetupFile);
+    ScopedBaseDirectory directoryOfSetupFile(
+            IO::getParentDirectory(aToolSetupFileName));
 
     cout<<"AbstractTool "<<getName()<<" loading model '"<<_modelFile<<"'"<<endl;
 
-    Model *model = 0;
-
+    Model *model = new Model(_modelFile);
     try {
-        model = new Model(_modelFile);
         model->finalizeFromProperties();
         if (rOriginalForceSet!=NULL)
             *rOriginalForceSet = model->getForceSet();
-    } catch(...) { // Properly restore current directory if an exception is thrown
-        IO::chDir(saveWorkingDirectory);
+    } catch(...) {
+        delete model;
         throw;
     }
     _model = model;
-    IO::chDir(saveWorkingDirectory);
 }
 
 void AbstractTool::
 updateModelForces(Model& model, const string &aToolSetupFileName, ForceSet *rOriginalForceSet )
 {
-    string saveWorkingDirectory = IO::getCwd();
-    string directoryOfSetupFile = IO::getParentDirectory(aToolSetupFileName);
-    IO::chDir(directoryOfSetupFile);
-
-    try {
-        if(rOriginalForceSet) *rOriginalForceSet = model.getForceSet();
-
-        // If replacing force set read in from model file, clear it here
-        if (_replaceForceSet){
-            // Can no longer just remove the model's forces.
-            // If the model is connected, then the model will
-            // maintain a list of subcomponents that refer to garbage.
-            model.cleanup();
-            model.updForceSet().setSize(0);
-        }
-
-        // Load force set(s)
-        for(int i=0;i<_forceSetFiles.getSize();i++) {
-            cout<<"Adding force object set from "<<_forceSetFiles[i]<<endl;
-            ForceSet *forceSet=new ForceSet(_forceSetFiles[i], true);
-            model.updForceSet().append(*forceSet);
-        }
-
-    } catch (...) {
-        IO::chDir(saveWorkingDirectory);
-        throw;
+    ScopedBaseDirectory directoryOfSetupFile(
+            IO::getParentDirectory(aToolSetupFileName));
+
+    if(rOriginalForceSet) *rOriginalForceSet = model.getForceSet();
+
+    // If replacing force set read in from model file, clear it here
+    if (_replaceForceSet){
+        // Can no longer just remove the model's forces.
+        // If the model is connected, then the model will
+        // maintain a list of subcomponents that refer to garbage.
+        model.cleanup();
+        model.updForceSet().setSize(0);
     }
 
-    IO::chDir(saveWorkingDirectory);
+    // Load force set(s)
+    for(int i=0;i<_forceSetFiles.getSize();i++) {
+        cout<<"Adding force object set from "<<_forceSetFiles[i]<<endl;
+        ForceSet *forceSet=new ForceSet(_forceSetFiles[i], true);
+        model.updForceSet().append(*forceSet);
+    }
 }
 //_____________________________________________________________________________
 /**
@@ -598,14 +585,12 @@ bool AbstractTool::createExternalLoads( const string& aExternalLoadsFileName,
         }
         else {
             // attempt to find the file local to the external loads XML file
-            std::string savedCwd = IO::getCwd();
-            IO::chDir(IO::getParentDirectory(aExternalLoadsFileName));
+            ScopedBaseDirectory directoryOfExternalLoads(
+                    IO::getParentDirectory(aExternalLoadsFileName));
             if (IO::FileExists(loadKinematicsFileName)) {
                 temp = new Storage(loadKinematicsFileName);
-                IO::chDir(savedCwd);
             }
             else {
-                IO::chDir(savedCwd);
                 throw Exception("AbstractTool: could not find external loads kinematics file '"
                     + loadKinematicsFileName + "'.");
             }
@@ -717,12 +702,11 @@ void AbstractTool::removeExternalLoadsFromModel()
                 string fileName="";
                 iter->getValueAs(fileName);
                 if (fileName!="" && fileName != "Unassigned"){
-                    string saveWorkingDirectory = IO::getCwd();
-                    string directoryOfSetupFile = IO::getParentDirectory(getDocumentFileName());
-                    IO::chDir(directoryOfSetupFile);
+                    ScopedBaseDirectory directoryOfSetupFile(
+                            IO::getParentDirectory(getDocumentFileName()));
                     //bool extLoadsFile=false;
                     try {
-                        SimTK::Xml::Document doc(fileName);
+                        SimTK::Xml::Document doc(IO::resolvePath(fileName));
                         doc.setIndentString("\t");
                         Xml::Element root = doc.getRootElement();
                         if (root.getElementTag()=="OpenSimDocument"){
@@ -756,11 +740,10 @@ void AbstractTool::removeExternalLoadsFromModel()
                                 else
                                     iter2->setValue(freq);
                             }
-                            doc.writeToFile(fileName);
+                            doc.writeToFile(IO::resolvePath(fileName));
                         }
                     }
                     catch(...){
-                        IO::chDir(saveWorkingDirectory);
                     }
                 }
             }
@@ -872,14 +855,10 @@ std::string AbstractTool::createExternalLoadsFile(const std::string& oldFile,
 {
     bool oldFileValid = !(oldFile=="" || oldFile=="Unassigned");
 
-    std::string savedCwd;
-    if(getDocument()) {
-        savedCwd = IO::getCwd();
-        IO::chDir(IO::getParentDirectory(getDocument()->getFileName()));
-    }
+    ScopedBaseDirectory directoryOfSetupFile(getDocument() ?
+            IO::getParentDirectory(getDocument()->getFileName()) : "");
     if (oldFileValid){
-        if(!ifstream(oldFile.c_str(), ios_base::in).good()) {
-            if(getDocument()) IO::chDir(savedCwd);
+        if(!IO::FileExists(oldFile)) {
             string msg =
                 "Object: ERR- Could not open file " + oldFile+ ". It may not exist or you don't have permission to read it.";
             throw Exception(msg,__FILE__,__LINE__);
@@ -899,7 +878,6 @@ std::string AbstractTool::createExternalLoadsFile(const std::string& oldFile,
         for(int i=0; i<9; i++){
             indices[i][0]= labels.findIndex(forceLabels[i]);
             if (indices[i][0]==-1){ // Something went wrong, abort here 
-                if(getDocument()) IO::chDir(savedCwd);
                 string msg =
                     "Object: ERR- Could not find label "+forceLabels[i]+ "in file " + oldFile+ ". Aborting.";
                 throw Exception(msg,__FILE__,__LINE__);
@@ -923,15 +901,12 @@ std::string AbstractTool::createExternalLoadsFile(const std::string& oldFile,
         _externalLoads.setDataFileName(oldFile);
         std::string newName=oldFile.substr(0, oldFile.length()-4)+".xml";
         _externalLoads.print(newName);
-        if(getDocument()) IO::chDir(savedCwd);
         cout<<"\n\n- Created ForceSet file " << newName << "to apply forces from " << oldFile << ".\n\n";
         return newName;
     }
     else {
-            if(getDocument()) IO::chDir(savedCwd);
             string msg =
                 "Object: ERR- Only one body is specified in " + oldFile+ ".";
             throw Exception(msg,__FILE__,__LINE__);
     }
-    if(getDocument()) IO::chDir(savedCwd);
 }
@@ -245,6 +245,10 @@ protected:
         values.append(getActuation(state));
         return values;
     }
+    void fillRecordValues(const SimTK::State& state,
+                          double* values, int numValues) const override {
+        if (numValues > 0) values[0] = getActuation(state);
+    }
 
 private:
     void constructProperties();
@@ -30,6 +30,7 @@
 // INCLUDES
 //=============================================================================
 #include "AnalysisSet.h"
+#include <OpenSim/Common/ComponentProfiler.h>
 
 
 using namespace OpenSim;
@@ -218,7 +219,10 @@ step( const SimTK::State& s, int stepNumber )
     int i;
     for(i=0;i<getSize();i++) {
         Analysis& analysis = get(i);
-        if (analysis.getOn()) analysis.step(s, stepNumber);
+        if (analysis.getOn()) {
+            ComponentProfiler::Scope scope(analysis, "step");
+            analysis.step(s, stepNumber);
+        }
     }
 }
 //_____________________________________________________________________________
@@ -28,6 +28,8 @@
 
 #include "simbody/internal/ElasticFoundationForce.h"
 
+#include <algorithm>
+
 namespace OpenSim {
 
 //==============================================================================
@@ -57,6 +59,10 @@ void ElasticFoundationForce::extendAddToSystem(SimTK::MultibodySystem& system) c
 
     SimTK::GeneralContactSubsystem& contacts = system.updContactSubsystem();
     SimTK::ContactSetIndex set = contacts.createContactSet();
+    // Beyond the const Component remember the body of each geometry so
+    // fillRecordValues() does not look the geometries up again.
+    ElasticFoundationForce* mutableThis = const_cast<ElasticFoundationForce *>(this);
+    mutableThis->_contactBodies.clear();
     SimTK::ElasticFoundationForce force(_model->updForceSubsystem(), contacts, set);
     force.setTransitionVelocity(transitionVelocity);
     for (int i = 0; i < contactParametersSet.getSize(); ++i)
@@ -83,6 +89,8 @@ void ElasticFoundationForce::extendAddToSystem(SimTK::MultibodySystem& system) c
             const auto X_BP = X_BF * X_FP;
             contacts.addBody(set, geom.getFrame().getMobilizedBody(),
                     geom.createSimTKContactGeometry(), X_BP);
+            mutableThis->_contactBodies.push_back(
+                    geom.getFrame().getMobilizedBodyIndex());
             if (dynamic_cast<const ContactMesh*>(&geom) != NULL) {
                 force.setBodyParameters(
                         SimTK::ContactSurfaceIndex(contacts.getNumBodies(set)-1), 
@@ -95,7 +103,6 @@ void ElasticFoundationForce::extendAddToSystem(SimTK::MultibodySystem& system) c
     }
 
     // Beyond the const Component get the index so we can access the SimTK::Force later
-    ElasticFoundationForce* mutableThis = const_cast<ElasticFoundationForce *>(this);
     mutableThis->_index = force.getForceIndex();
 }
 
@@ -358,50 +365,33 @@ OpenSim::Array<std::string> ElasticFoundationForce::getRecordLabels() const
  */
 OpenSim::Array<double> ElasticFoundationForce::getRecordValues(const SimTK::State& state) const 
 {
-    OpenSim::Array<double> values(1);
-
-    const ContactParametersSet& contactParametersSet = 
-        get_contact_parameters();
+    OpenSim::Array<double> values(0.0, 6*int(_contactBodies.size()));
+    fillRecordValues(state, values.get(), values.getSize());
+    return values;
+}
 
-    const SimTK::ElasticFoundationForce& simtkForce = 
-        (SimTK::ElasticFoundationForce &)(_model->getForceSubsystem().getForce(_index));
+void ElasticFoundationForce::fillRecordValues(const SimTK::State& state,
+                                              double* values, int numValues) const
+{
+    const auto& forceSubsys = _model->getForceSubsystem();
+    const SimTK::Force& abstractForce = forceSubsys.getForce(_index);
+    const auto& simtkForce = (SimTK::ElasticFoundationForce &)(abstractForce);
 
-    SimTK::Vector_<SimTK::SpatialVec> bodyForces(0);
-    SimTK::Vector_<SimTK::Vec3> particleForces(0);
-    SimTK::Vector mobilityForces(0);
+    // Scratch space reused across calls to avoid allocating at every step.
+    thread_local SimTK::Vector_<SimTK::SpatialVec> bodyForces;
+    thread_local SimTK::Vector_<SimTK::Vec3> particleForces;
+    thread_local SimTK::Vector mobilityForces;
 
     //get the net force added to the system contributed by the Spring
     simtkForce.calcForceContribution(state, bodyForces, particleForces,
                                      mobilityForces);
 
-    for (int i = 0; i < contactParametersSet.getSize(); ++i)
-    {
-        ContactParameters& params = contactParametersSet.get(i);
-        for (int j = 0; j < params.getGeometry().size(); ++j)
-        {
-            // TODO: Dependency of ElasticFoundationForce on ContactGeometry
-            // should be handled by Sockets.
-            const ContactGeometry* contactGeom = nullptr;
-            if (getModel().hasComponent<ContactGeometry>(params.getGeometry()[j]))
-                contactGeom = &getModel().getComponent<ContactGeometry>(
-                    params.getGeometry()[j]);
-            else
-                contactGeom = &getModel().getComponent<ContactGeometry>(
-                    "./contactgeometryset/" + params.getGeometry()[j]);
-
-            const ContactGeometry& geom = *contactGeom;
-    
-            const auto& mbi = geom.getFrame().getMobilizedBodyIndex();
-            const auto& thisBodyForce = bodyForces(mbi);
-            SimTK::Vec3 forces = thisBodyForce[1];
-            SimTK::Vec3 torques = thisBodyForce[0];
-
-            values.append(3, &forces[0]);
-            values.append(3, &torques[0]);
-        }
+    const int n = std::min(numValues, 6*int(_contactBodies.size()));
+    for (int k = 0; k < n; ++k) {
+        const auto& thisBodyForce = bodyForces(_contactBodies[k/6]);
+        // forces first, then torques
+        values[k] = k%6 < 3 ? thisBodyForce[1][k%6] : thisBodyForce[0][k%6-3];
     }
-
-    return values;
 }
 
 
@@ -102,10 +102,19 @@ public:
     *  Provide the value(s) to be reported that correspond to the labels
     */
     OpenSim::Array<double> getRecordValues(const SimTK::State& state) const override ;
+    /**
+    *  Write the value(s) to be reported into a preallocated buffer
+    */
+    void fillRecordValues(const SimTK::State& state,
+                          double* values, int numValues) const override;
 private:
     // INITIALIZATION
     void constructProperties();
 
+    // The mobilized body of each contact geometry, in the order of the
+    // record labels; filled in extendAddToSystem().
+    SimTK::ResetOnCopy<std::vector<SimTK::MobilizedBodyIndex>> _contactBodies;
+
 //==============================================================================
 };  // END of class ElasticFoundationForce
 //==============================================================================
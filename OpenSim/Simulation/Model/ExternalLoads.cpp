@@ -182,20 +182,17 @@ void ExternalLoads::extendConnectToModel(Model& aModel)
     Storage *forceData = nullptr;
     auto loadDataFromDirectoryAdjacentToFile =
         [this, &forceData](const std::string& filepath) {
-            // Change working directory the ExternalLoads location
-            std::string savedCwd = IO::getCwd();
-            IO::chDir(IO::getParentDirectory(filepath));
+            // Resolve the data file relative to the ExternalLoads location
+            ScopedBaseDirectory directoryOfFile(
+                    IO::getParentDirectory(filepath));
             try {
                 forceData = new Storage(this->_dataFileName);
             }
             catch (const std::exception &ex) {
                 cout << "Error: failed to read ExternalLoads data file '"
                     << this->_dataFileName <<"'." << endl;
-                if (this->getDocument())
-                    IO::chDir(savedCwd);
                 throw(ex);
             }
-            IO::chDir(savedCwd);
     };
     if (_dataFileName.length() > 0) {
         if(IO::FileExists(_dataFileName))
@@ -440,21 +437,18 @@ void ExternalLoads::updateFromXMLNode(SimTK::Xml::Element& aNode, int versionNum
         if (kinFilterNode != aNode.element_end()){
             _lowpassCutoffFrequencyForLoadKinematics = kinFilterNode->getValueAs<double>();
             }
-            bool changeWorkingDir = false;
-            std::string savedCwd;
-            // Change to directory of Document
-            if(!ifstream(_dataFileName.c_str(), ios_base::in).good()) {
+            // Resolve relative to the directory of the Document if needed
+            std::unique_ptr<ScopedBaseDirectory> directoryOfDocument;
+            if(!IO::FileExists(_dataFileName)) {
             string msg =
                     "Object: ERR- Could not open file " + _dataFileName+ "IO. It may not exist or you don't have permission to read it.";
                 cout << msg;
-                // Try switching to directory of setup file before aborting
+                // Try the directory of setup file before aborting
                 if(getDocument()) {
-                    savedCwd = IO::getCwd();
-                    IO::chDir(IO::getParentDirectory(getDocument()->getFileName()));
-                    changeWorkingDir=true;
+                    directoryOfDocument.reset(new ScopedBaseDirectory(
+                        IO::getParentDirectory(getDocument()->getFileName())));
                 }
-                if(!ifstream(_dataFileName.c_str(), ios_base::in).good()) {
-                    if(changeWorkingDir) IO::chDir(savedCwd);
+                if(!IO::FileExists(_dataFileName)) {
             throw Exception(msg,__FILE__,__LINE__);
                 }
             }
@@ -465,7 +459,7 @@ void ExternalLoads::updateFromXMLNode(SimTK::Xml::Element& aNode, int versionNum
                 dataSource->makeStorageLabelsUnique();
                 dataSource->print(_dataFileName);
             }
-            if(changeWorkingDir) IO::chDir(savedCwd);
+            directoryOfDocument.reset();
             
             const Array<string> &labels = dataSource->getColumnLabels();
             // Populate data file and other things that haven't changed
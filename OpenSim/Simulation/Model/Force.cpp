@@ -25,6 +25,8 @@
 #include "Model.h"
 #include <OpenSim/Simulation/Model/ForceAdapter.h>
 
+#include <algorithm>
+
 
 using namespace SimTK;
 
@@ -148,6 +150,26 @@ bool Force::appliesForce(const SimTK::State& s) const
     return get_appliesForce();
 }
 
+void Force::calcForceContribution(const SimTK::State& s,
+        SimTK::Vector_<SimTK::SpatialVec>& bodyForces,
+        SimTK::Vector& generalizedForces) const
+{
+    OPENSIM_THROW_IF_FRMOBJ(!_index.isValid(), Exception,
+            "Force has not been added to a System; call initSystem() first.");
+    SimTK::Vector_<SimTK::Vec3> particleForces;
+    getModel().getForceSubsystem().getForce(_index).calcForceContribution(
+            s, bodyForces, particleForces, generalizedForces);
+}
+
+void Force::fillRecordValues(const SimTK::State& state,
+                             double* values, int numValues) const
+{
+    const Array<double> recordValues = getRecordValues(state);
+    const int n = std::min(numValues, recordValues.getSize());
+    std::copy(recordValues.get(), recordValues.get() + n, values);
+    std::fill(values + n, values + numValues, SimTK::NaN);
+}
+
 //-----------------------------------------------------------------------------
 // ABSTRACT METHODS
 //-----------------------------------------------------------------------------
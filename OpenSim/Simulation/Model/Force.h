@@ -82,6 +82,15 @@ public:
     /** %Set whether or not the Force is applied.                             */
     void setAppliesForce(SimTK::State& s, bool applyForce) const;
 
+    /** Compute the body forces and generalized forces that this Force would
+    apply in the given state, whether or not it is currently applied. The
+    outputs are resized to the number of bodies and of generalized speeds
+    of the system. The state must be realized to at least the stage the
+    Force needs (typically Stage::Velocity).                              */
+    void calcForceContribution(const SimTK::State& s,
+                               SimTK::Vector_<SimTK::SpatialVec>& bodyForces,
+                               SimTK::Vector& generalizedForces) const;
+
     /**
      * Methods to query a Force for the value actually applied during 
      * simulation. The names of the quantities (column labels) is returned by 
@@ -99,6 +108,16 @@ public:
     getRecordValues(const SimTK::State& state) const {
         return OpenSim::Array<double>();
     };
+    /**
+     * Write the values of getRecordValues() into the caller's buffer
+     * `values`, which holds `numValues` entries (the number of record
+     * labels), without allocating. Reporters use this to fill one
+     * preallocated row per time step. The default implementation copies the
+     * result of getRecordValues() (padding with NaN if it is short); Forces
+     * that are commonly reported at every time step override it.
+     */
+    virtual void fillRecordValues(const SimTK::State& state,
+                                  double* values, int numValues) const;
 
 
     /** Return a flag indicating whether the Force is applied along a Path. If
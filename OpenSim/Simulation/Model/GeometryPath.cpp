@@ -29,6 +29,7 @@
 #include "MovingPathPoint.h"
 #include "PointForceDirection.h"
 #include <OpenSim/Simulation/Wrap/PathWrap.h>
+#include <OpenSim/Common/ComponentProfiler.h>
 #include "Model.h"
 
 //=============================================================================
@@ -822,6 +823,8 @@ void GeometryPath::computePath(const SimTK::State& s) const
         return;
     }
 
+    ComponentProfiler::Scope scope(*this, "computePath");
+
     // Clear the current path.
     Array<AbstractPathPoint*>& currentPath = 
         updCacheVariableValue<Array<AbstractPathPoint*> >(s, "current_path");
@@ -26,6 +26,7 @@
 // INCLUDES
 //=============================================================================
 
+#include <OpenSim/Common/ComponentProfiler.h>
 #include <OpenSim/Common/IO.h>
 #include <OpenSim/Common/XMLDocument.h>
 #include <OpenSim/Common/ScaleSet.h>
@@ -55,6 +56,7 @@
 
 #include <iostream>
 #include <string>
+#include <thread>
 
 #include <OpenSim/Simulation/AssemblySolver.h>
 
@@ -104,7 +106,7 @@ Model::Model(const string &aFileName) :
     setNull();
     updateFromXMLDocument();
 
-    _fileName = aFileName;
+    _fileName = IO::resolvePath(aFileName);
     cout << "Loaded model " << getName() << " from file " << getInputFileName() << endl;
 
     try {
@@ -300,6 +302,21 @@ void Model::updateFromXMLNode(SimTK::Xml::Element& aNode, int versionNumber)
      setDefaultProperties();
 }
 
+//_____________________________________________________________________________
+/*
+ * The sets of components whose elements are read concurrently. Components
+ * are only connected to each other when the model is finalized.
+ */
+std::vector<int> Model::getPropertiesToReadConcurrently(
+        int versionNumber) const
+{
+    if (versionNumber < XMLDocument::getLatestVersion())
+        return {};
+    return {PropertyIndex_BodySet, PropertyIndex_JointSet,
+            PropertyIndex_ConstraintSet, PropertyIndex_ForceSet,
+            PropertyIndex_MarkerSet, PropertyIndex_ContactGeometrySet};
+}
+
 
 //=============================================================================
 // CONSTRUCTION METHODS
@@ -406,6 +423,16 @@ void Model::buildSystem() {
 //------------------------------------------------------------------------------
 // Requires that buildSystem() has already been called.
 SimTK::State& Model::initializeState() {
+    return initializeStateFrom(nullptr);
+}
+
+SimTK::State& Model::initializeState(const SimTK::State& initialState) {
+    return initializeStateFrom(&initialState);
+}
+
+// If initialState is given, its time and continuous state variables are used
+// as they are, instead of assembling the default configuration.
+SimTK::State& Model::initializeStateFrom(const SimTK::State* initialState) {
     if (!hasSystem()) 
         throw Exception("Model::initializeState(): call buildSystem() first.");
 
@@ -424,6 +451,8 @@ SimTK::State& Model::initializeState() {
     // Process the modified modeling option.
     getMultibodySystem().realizeModel(_workingState);
 
+    updateAuxiliaryStateOwners(_workingState);
+
     // Invoke the ModelComponent interface for initializing the state.
     initStateFromProperties(_workingState);
 
@@ -432,6 +461,19 @@ SimTK::State& Model::initializeState() {
     // geometry placements are frozen.
     getMultibodySystem().realize(_workingState, Stage::Instance);
 
+    if (initialState) {
+        OPENSIM_THROW_IF_FRMOBJ(
+                initialState->getNQ() != _workingState.getNQ() ||
+                initialState->getNU() != _workingState.getNU() ||
+                initialState->getNZ() != _workingState.getNZ(), Exception,
+                "The initial state does not have the same state variables "
+                "as this Model.");
+        _workingState.setTime(initialState->getTime());
+        _workingState.updQ() = initialState->getQ();
+        _workingState.updU() = initialState->getU();
+        _workingState.updZ() = initialState->getZ();
+    }
+
     // Realize the initial configuration in preparation for assembly. This
     // initial configuration does not necessarily satisfy constraints.
     getMultibodySystem().realize(_workingState, Stage::Position);
@@ -440,9 +482,12 @@ SimTK::State& Model::initializeState() {
     for (int i=0; i<getProbeSet().getSize(); ++i)
         getProbeSet().get(i).reset(_workingState);
 
-    // Do the assembly
+    // Do the assembly, unless the initial state is already assembled.
     createAssemblySolver(_workingState);
-    assemble(_workingState);
+    if (initialState)
+        getMultibodySystem().realize(_workingState, Stage::Velocity);
+    else
+        assemble(_workingState);
     // We can now collect up all the fixed geometry, which needs full configuration.
     if (getUseVisualizer())
         _modelViz->collectFixedGeometry(_workingState);
@@ -681,6 +726,9 @@ void Model::extendFinalizeFromProperties()
 {
     Super::extendFinalizeFromProperties();
 
+    // The component tree may have changed.
+    clearCachedComponentLists();
+
     // wipe-out the existing System 
     _matter.reset();
     _forceSubsystem.reset();
@@ -967,6 +1015,87 @@ void Model::extendConnectToModel(Model &model)
 
     // TODO: Get rid of the SimbodyEngine
     updSimbodyEngine().connectSimbodyEngineToModel(*this);
+
+    updateCachedComponentLists();
+}
+
+void Model::updateCachedComponentLists()
+{
+    clearCachedComponentLists();
+
+    // A single traversal of the component tree fills all the lists.
+    for (const auto& comp : getComponentList()) {
+        if (const auto* force = dynamic_cast<const Force*>(&comp)) {
+            _cachedForces.push_back(force);
+            if (const auto* act = dynamic_cast<const Actuator*>(force)) {
+                _cachedActuators.push_back(act);
+                if (const auto* muscle = dynamic_cast<const Muscle*>(act))
+                    _cachedMuscles.push_back(muscle);
+            }
+        }
+        else if (const auto* controller =
+                dynamic_cast<const Controller*>(&comp))
+            _cachedControllers.push_back(controller);
+        else if (const auto* coord = dynamic_cast<const Coordinate*>(&comp))
+            _cachedCoordinates.push_back(coord);
+        else if (const auto* probe = dynamic_cast<const Probe*>(&comp))
+            _cachedProbes.push_back(probe);
+    }
+    _cachedComponentListsAreValid = true;
+}
+
+void Model::clearCachedComponentLists()
+{
+    _cachedForces.clear();
+    _cachedActuators.clear();
+    _cachedMuscles.clear();
+    _cachedControllers.clear();
+    _cachedCoordinates.clear();
+    _cachedProbes.clear();
+    _cachedComponentListsAreValid = false;
+}
+
+void Model::checkCachedComponentLists() const
+{
+    OPENSIM_THROW_IF_FRMOBJ(!_cachedComponentListsAreValid, Exception,
+        "The cached component lists are only available after the Model's "
+        "connections are finalized (e.g., by initSystem()).");
+}
+
+const std::vector<const Force*>& Model::getCachedForces() const
+{
+    checkCachedComponentLists();
+    return _cachedForces;
+}
+
+const std::vector<const Actuator*>& Model::getCachedActuators() const
+{
+    checkCachedComponentLists();
+    return _cachedActuators;
+}
+
+const std::vector<const Muscle*>& Model::getCachedMuscles() const
+{
+    checkCachedComponentLists();
+    return _cachedMuscles;
+}
+
+const std::vector<const Controller*>& Model::getCachedControllers() const
+{
+    checkCachedComponentLists();
+    return _cachedControllers;
+}
+
+const std::vector<const Coordinate*>& Model::getCachedCoordinates() const
+{
+    checkCachedComponentLists();
+    return _cachedCoordinates;
+}
+
+const std::vector<const Probe*>& Model::getCachedProbes() const
+{
+    checkCachedComponentLists();
+    return _cachedProbes;
 }
 
 
@@ -1168,12 +1297,10 @@ void Model::equilibrateMuscles(SimTK::State& state)
     bool failed = false;
     string errorMsg = "";
 
-    auto muscles = getComponentList<Muscle>();
-
-    for (auto& muscle : muscles) {
-        if (muscle.appliesForce(state)){
+    for (const Muscle* muscle : getCachedMuscles()) {
+        if (muscle->appliesForce(state)){
             try{
-                muscle.computeEquilibrium(state);
+                muscle->computeEquilibrium(state);
             }
             catch (const std::exception& e) {
                 if(!failed){ // haven't failed to equilibrate other muscles yet
@@ -1895,9 +2022,10 @@ const Vector& Model::getControls(const SimTK::State &s) const
 /** Compute the controls the model */
 void Model::computeControls(const SimTK::State& s, SimTK::Vector &controls) const
 {
-    for (auto& controller : getComponentList<Controller>()) {
-        if (controller.isEnabled()) {
-            controller.computeControls(s, controls);
+    for (const Controller* controller : getCachedControllers()) {
+        if (controller->isEnabled()) {
+            ComponentProfiler::Scope scope(*controller, "computeControls");
+            controller->computeControls(s, controls);
         }
     }
 }
@@ -2119,6 +2247,233 @@ void Model::computeStateVariableDerivatives(const SimTK::State &s) const
     realizeAcceleration(s);
 }
 
+//_____________________________________________________________________________
+/**
+ * Find the Component that added each auxiliary state variable. The q's and
+ * u's are the Coordinates' state variables; every other state variable was
+ * allocated by its Component in the Component's subsystem.
+ */
+void Model::updateAuxiliaryStateOwners(const SimTK::State& s)
+{
+    _auxiliaryStateOwners.clear();
+    _auxiliaryStateOwners.resize(s.getNZ(),
+            std::pair<const Component*, std::string>(nullptr, ""));
+
+    const Array<std::string> names = getStateVariableNames();
+    for (int i = 0; i < names.getSize(); ++i) {
+        const StateVariable* sv = traverseToStateVariable(names[i]);
+        if (!sv || dynamic_cast<const Coordinate*>(&sv->getOwner())) continue;
+        const int iz = s.getZStart(sv->getSubsysIndex()) + sv->getVarIndex();
+        _auxiliaryStateOwners[iz] =
+                std::make_pair(&sv->getOwner(), sv->getName());
+    }
+}
+
+int Model::getNumImplicitResiduals(const SimTK::State& s) const
+{
+    return s.getNQ() + s.getNU() + s.getNZ() + s.getNQErr() + s.getNUErr();
+}
+
+//_____________________________________________________________________________
+/**
+ * Calculate the implicit residual. The multibody residual is the inverse
+ * dynamics of the matter subsystem given the forces applied at Dynamics
+ * stage, so the accelerations are never computed (unless a z has no implicit
+ * form, which requires realizing to Acceleration).
+ */
+SimTK::Vector Model::calcImplicitResidual(const SimTK::State& s,
+        const SimTK::Vector& yDot, const SimTK::Vector& lambda) const
+{
+    const int nq = s.getNQ(), nu = s.getNU(), nz = s.getNZ();
+    const int nqerr = s.getNQErr(), nuerr = s.getNUErr();
+    OPENSIM_THROW_IF_FRMOBJ(yDot.size() != s.getNY(), Exception,
+            "Expected yDot to have " + std::to_string(s.getNY()) +
+            " elements, but it has " + std::to_string(yDot.size()) + ".");
+    OPENSIM_THROW_IF_FRMOBJ(
+            lambda.size() != 0 && lambda.size() != s.getNMultipliers(),
+            Exception,
+            "Expected lambda to have " + std::to_string(s.getNMultipliers()) +
+            " elements, but it has " + std::to_string(lambda.size()) + ".");
+    OPENSIM_THROW_IF_FRMOBJ((int)_auxiliaryStateOwners.size() != nz,
+            Exception, "The state does not belong to this Model's System; "
+            "call initSystem() first.");
+
+    const SimTK::MultibodySystem& system = getMultibodySystem();
+    SimTK::Vector residual(getNumImplicitResiduals(s));
+
+    // Kinematics.
+    system.realize(s, Stage::Velocity);
+    residual(0, nq) = yDot(0, nq) - s.getQDot();
+    residual(nq + nu + nz, nqerr) = s.getQErr();
+    residual(nq + nu + nz + nqerr, nuerr) = s.getUErr();
+
+    // Multibody dynamics.
+    system.realize(s, Stage::Dynamics);
+    const SimTK::Vector knownLambda =
+            lambda.size() ? lambda : SimTK::Vector(s.getNMultipliers(), 0.0);
+    SimTK::Vector multibodyResidual;
+    getMatterSubsystem().calcResidualForce(s,
+            system.getMobilityForces(s, Stage::Dynamics),
+            system.getRigidBodyForces(s, Stage::Dynamics),
+            yDot(nq, nu), knownLambda, multibodyResidual);
+    residual(nq, nu) = multibodyResidual;
+
+    // Auxiliary state variables.
+    for (int i = 0; i < nz; ++i) {
+        const auto& owner = _auxiliaryStateOwners[i];
+        const double zdot = yDot[nq + nu + i];
+        if (owner.first) {
+            residual[nq + nu + i] = owner.first->
+                    calcStateVariableImplicitResidual(s, owner.second, zdot);
+        } else {
+            system.realize(s, Stage::Acceleration);
+            residual[nq + nu + i] = zdot - s.getZDot()[i];
+        }
+    }
+    return residual;
+}
+
+//_____________________________________________________________________________
+/**
+ * Copy the time and all the state variables of a state of a Model into a
+ * state of a copy of that Model: q, u, z and the discrete variables, which
+ * hold, e.g., actuator overrides, discrete controls and whether forces and
+ * constraints are enabled. The discrete variables that invalidate the Model
+ * stage are the same in both states (they are modeling options such as the
+ * use of Euler angles) and are left alone, since changing them would
+ * reallocate q, u and z.
+ */
+static void copyStateValues(const SimTK::State& from, SimTK::State& to)
+{
+    for (SimTK::SubsystemIndex sx(0); sx < from.getNumSubsystems(); ++sx) {
+        for (SimTK::DiscreteVariableIndex dx(0);
+                dx < from.getNumDiscreteVariables(sx); ++dx) {
+            if (from.getDiscreteVarInvalidatesStage(sx, dx) <= Stage::Model)
+                continue;
+            to.updDiscreteVariable(sx, dx) = from.getDiscreteVariable(sx, dx);
+        }
+    }
+    to.setTime(from.getTime());
+    to.updQ() = from.getQ();
+    to.updU() = from.getU();
+    to.updZ() = from.getZ();
+}
+
+//_____________________________________________________________________________
+/**
+ * Evaluate the residuals in contiguous chunks of states, one per thread, as
+ * ModelTemplate::createInstances() does. Every thread other than the calling
+ * one gets its own copy of the Model, which is created and initialized
+ * before any thread starts, since copying reads the components while the
+ * calling thread evaluates with them. For each of its states, a thread copies
+ * all the state variables into the working state of its copy (see
+ * copyStateValues()). If an evaluation throws, the first exception is
+ * rethrown once all the threads have finished.
+ */
+std::vector<SimTK::Vector> Model::calcImplicitResiduals(
+        const std::vector<SimTK::State>& states,
+        const std::vector<SimTK::Vector>& yDots,
+        const std::vector<SimTK::Vector>& lambdas, int numThreads) const
+{
+    const int numStates = (int)states.size();
+    OPENSIM_THROW_IF_FRMOBJ((int)yDots.size() != numStates, Exception,
+            "Expected one yDot per state.");
+    OPENSIM_THROW_IF_FRMOBJ(
+            !lambdas.empty() && (int)lambdas.size() != numStates, Exception,
+            "Expected one lambda per state, or none.");
+    const SimTK::Vector noLambda;
+    auto lambda = [&](int i) -> const SimTK::Vector& {
+        return lambdas.empty() ? noLambda : lambdas[i];
+    };
+
+    std::vector<SimTK::Vector> residuals(numStates);
+    if (numThreads <= 0)
+        numThreads = std::max(1, (int)std::thread::hardware_concurrency());
+    numThreads = std::min(numThreads, numStates);
+    if (numThreads <= 1) {
+        for (int i = 0; i < numStates; ++i)
+            residuals[i] = calcImplicitResidual(states[i], yDots[i], lambda(i));
+        return residuals;
+    }
+
+    std::vector<std::unique_ptr<Model>> copies(numThreads);
+    for (int k = 1; k < numThreads; ++k) {
+        copies[k].reset(clone());
+        copies[k]->initSystem(states[(k * numStates) / numThreads]);
+    }
+
+    std::vector<std::exception_ptr> errors(numThreads);
+    auto calcChunk = [&](int k) {
+        const int first = (k * numStates) / numThreads;
+        const int last = ((k + 1) * numStates) / numThreads;
+        try {
+            if (k == 0) {
+                for (int i = first; i < last; ++i)
+                    residuals[i] = calcImplicitResidual(states[i], yDots[i],
+                                                        lambda(i));
+                return;
+            }
+            Model& copy = *copies[k];
+            SimTK::State& s = copy.updWorkingState();
+            for (int i = first; i < last; ++i) {
+                copyStateValues(states[i], s);
+                residuals[i] = copy.calcImplicitResidual(s, yDots[i],
+                                                         lambda(i));
+            }
+        } catch (...) {
+            errors[k] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int k = 1; k < numThreads; ++k)
+        threads.emplace_back(calcChunk, k);
+    calcChunk(0);
+    for (auto& thread : threads) thread.join();
+
+    for (const auto& error : errors)
+        if (error) std::rethrow_exception(error);
+    return residuals;
+}
+
+//_____________________________________________________________________________
+/**
+ * Detect the sparsity of the implicit residual by perturbing each of the
+ * variables [y; yDot; lambda] and recording which residuals change.
+ */
+std::vector<std::pair<int, int>> Model::calcImplicitResidualSparsity(
+        const SimTK::State& s, const SimTK::Vector& yDot,
+        const SimTK::Vector& lambda) const
+{
+    const int ny = s.getNY(), nm = s.getNMultipliers();
+    SimTK::State state = s;
+    SimTK::Vector perturbedYDot = yDot;
+    SimTK::Vector perturbedLambda =
+            lambda.size() ? lambda : SimTK::Vector(nm, 0.0);
+    const SimTK::Vector nominal =
+            calcImplicitResidual(state, perturbedYDot, perturbedLambda);
+
+    std::vector<std::pair<int, int>> nonzeros;
+    auto perturb = [&](int column, double& value) {
+        const double original = value;
+        value += 1e-4 * (1.0 + std::abs(original));
+        if (column < ny) state.updY()[column] = value;
+        const SimTK::Vector perturbed =
+                calcImplicitResidual(state, perturbedYDot, perturbedLambda);
+        for (int row = 0; row < perturbed.size(); ++row)
+            if (perturbed[row] != nominal[row])
+                nonzeros.emplace_back(row, column);
+        value = original;
+        if (column < ny) state.updY()[column] = value;
+    };
+
+    SimTK::Vector y = s.getY();
+    for (int i = 0; i < ny; ++i) perturb(i, y[i]);
+    for (int i = 0; i < ny; ++i) perturb(ny + i, perturbedYDot[i]);
+    for (int i = 0; i < nm; ++i) perturb(2 * ny + i, perturbedLambda[i]);
+    return nonzeros;
+}
+
 /**
  * Get the total mass of the model
  *
@@ -58,10 +58,12 @@ class Constraint;
 class ConstraintSet;
 class ContactGeometry;
 class Controller;
+class Coordinate;
 class CoordinateSet;
 class Force;
 class Frame;
 class Muscle;
+class Probe;
 class Storage;
 class ScaleSet;
 
@@ -395,6 +397,23 @@ public:
         return initializeState();
     }
 
+    /** Same as initializeState(), but the time and the continuous state
+    variables (q, u and z) are copied from `initialState` instead of being
+    taken from the default values of the properties, and the configuration is
+    not assembled again. `initialState` must be a state of a Model with the
+    same state variables, typically the Model that this one was copied from
+    after its own initSystem(). Discrete variables still come from the
+    properties. This is how ModelTemplate initializes its instances. **/
+    SimTK::State& initializeState(const SimTK::State& initialState);
+
+    /** Convenience method that invokes buildSystem() and then
+    initializeState(initialState). **/
+    SimTK::State& initSystem(const SimTK::State& initialState)
+            SWIG_DECLARE_EXCEPTION {
+        buildSystem();
+        return initializeState(initialState);
+    }
+
 
     /** Convenience method that returns a reference to the model's 'working'
     state. This is just returning the reference that was returned by 
@@ -738,6 +757,26 @@ public:
     ComponentSet& updMiscModelComponentSet() 
     {   return upd_ComponentSet(); };
 
+#ifndef SWIG
+    /** @name Cached component lists
+    Flat lists of the Model's components of commonly iterated types, in the
+    order that getComponentList<T>() visits them. The lists are built when
+    the Model's connections are finalized (e.g., by initSystem()) and are
+    cleared whenever the component tree may change (finalizeFromProperties(),
+    which is also invoked when adding components). Iterating a list involves
+    no traversal of the component tree and no dynamic_cast per component,
+    which matters in loops evaluated at every time step of large models.
+    Accessing a list before connections are finalized throws an Exception. **/
+    /**@{**/
+    const std::vector<const Force*>& getCachedForces() const;
+    const std::vector<const Actuator*>& getCachedActuators() const;
+    const std::vector<const Muscle*>& getCachedMuscles() const;
+    const std::vector<const Controller*>& getCachedControllers() const;
+    const std::vector<const Coordinate*>& getCachedCoordinates() const;
+    const std::vector<const Probe*>& getCachedProbes() const;
+    /**@}**/
+#endif
+
     /**
      * Get the number of analyses in the model.
      * @return The number of analyses.
@@ -845,6 +884,65 @@ public:
     int getNumMuscleStates() const;
     int getNumProbeStates() const;
 
+    /** @name Implicit dynamics
+    The dynamics of the Model in implicit form, r(y, ydot, lambda) = 0, as
+    used by direct collocation methods, which impose the dynamics at many
+    time points at once instead of integrating them forward.
+
+    The residual has getNumImplicitResiduals() entries, in this order:
+    - nq kinematic residuals: qdot - N(q) u;
+    - nu multibody residuals: the generalized forces that are missing to
+      produce the accelerations udot with the multipliers lambda (inverse
+      dynamics; see SimTK::SimbodyMatterSubsystem::calcResidualForce());
+    - nz residuals of the auxiliary state variables (e.g., muscle activations
+      and fiber lengths); see Component::calcStateVariableImplicitResidual();
+    - the position-level (qerr) and velocity-level (uerr) constraint errors.
+
+    `yDot` contains the derivatives of the continuous state variables in the
+    order of the System's Y, [qdot; udot; zdot], and `lambda` contains one
+    Lagrange multiplier per constraint equation (State::getNMultipliers());
+    an empty `lambda` means zero multipliers. The controls are those computed
+    by the Model's controllers for the given state. **/
+    /**@{**/
+    /** The number of entries of the residual: nq + nu + nz + nqerr + nuerr. */
+    int getNumImplicitResiduals(const SimTK::State& s) const;
+
+    /** Calculate the implicit residual for the state `s`. This realizes `s`
+    to Dynamics (and to Acceleration if it has auxiliary state variables
+    whose owner provides no implicit form). Requires initSystem(). */
+    SimTK::Vector calcImplicitResidual(const SimTK::State& s,
+            const SimTK::Vector& yDot,
+            const SimTK::Vector& lambda = SimTK::Vector()) const;
+
+    /** Calculate the implicit residuals of many states, e.g., the nodes of a
+    direct collocation grid, using `numThreads` threads (0 means as many
+    threads as hardware threads). Each state has its own `yDots` entry and,
+    if `lambdas` is not empty, its own `lambdas` entry. The first chunk of
+    states is evaluated by the calling thread with this Model; each other
+    thread uses its own copy of the Model, because the components cache
+    intermediate results. The copies are made before the threads start, and
+    each state, including its discrete variables (e.g., actuator overrides
+    and disabled forces), is copied into the working state of the copy. The
+    result does not depend on the number of threads. */
+    std::vector<SimTK::Vector> calcImplicitResiduals(
+            const std::vector<SimTK::State>& states,
+            const std::vector<SimTK::Vector>& yDots,
+            const std::vector<SimTK::Vector>& lambdas =
+                    std::vector<SimTK::Vector>(),
+            int numThreads = 1) const;
+
+    /** The sparsity pattern of the Jacobian of the implicit residual with
+    respect to [y; yDot; lambda], as (row, column) pairs of the entries that
+    are not zero, sorted by column and then by row. The pattern is detected by
+    perturbing each variable in turn at the given point (a state that is
+    typical of the problem), so an entry that happens to vanish at this point
+    is missed. It depends only on the structure of the Model, so compute it
+    once per problem. */
+    std::vector<std::pair<int, int>> calcImplicitResidualSparsity(
+            const SimTK::State& s, const SimTK::Vector& yDot,
+            const SimTK::Vector& lambda = SimTK::Vector()) const;
+    /**@}**/
+
     //--------------------------------------------------------------------------
     // SETS
     //--------------------------------------------------------------------------
@@ -1067,6 +1165,14 @@ public:
     
     //--------------------------------------------------------------------------
 
+protected:
+    /** The component sets of the %Model are independent of one another until
+    the %Model is finalized, so they are read concurrently from documents
+    of the latest version. Older documents are updated while they are read,
+    and some updates look outside of the set being read. */
+    std::vector<int> getPropertiesToReadConcurrently(
+            int versionNumber) const override;
+
 private:
     // %Set the values of all data members to an appropriate "null" value.
     void setNull();
@@ -1082,6 +1188,18 @@ private:
 
     void createAssemblySolver(const SimTK::State& s);
 
+    // Shared by the initializeState() overloads; initialState may be null.
+    SimTK::State& initializeStateFrom(const SimTK::State* initialState);
+
+    // Fill _auxiliaryStateOwners from the state variables of the components.
+    void updateAuxiliaryStateOwners(const SimTK::State& s);
+
+    // Fill (or clear) the cached lists of components of commonly iterated
+    // types.
+    void updateCachedComponentLists();
+    void clearCachedComponentLists();
+    void checkCachedComponentLists() const;
+
     // To provide access to private _modelComponents member.
     friend class Component; 
 
@@ -1173,6 +1291,23 @@ private:
     // Default values pooled from Actuators upon system creation.
     mutable SimTK::Vector _defaultControls;
 
+    // Flat lists of components of commonly iterated types (see
+    // getCachedForces()). They point into this Model, so they are not copied.
+    SimTK::ResetOnCopy<std::vector<const Force*>>      _cachedForces;
+    SimTK::ResetOnCopy<std::vector<const Actuator*>>   _cachedActuators;
+    SimTK::ResetOnCopy<std::vector<const Muscle*>>     _cachedMuscles;
+    SimTK::ResetOnCopy<std::vector<const Controller*>> _cachedControllers;
+    SimTK::ResetOnCopy<std::vector<const Coordinate*>> _cachedCoordinates;
+    SimTK::ResetOnCopy<std::vector<const Probe*>>      _cachedProbes;
+    SimTK::ResetOnCopy<bool> _cachedComponentListsAreValid;
+
+    // The Component that added each auxiliary (z) state variable, and the
+    // name of the variable, in the order of the System's Z; filled by
+    // initializeState() for calcImplicitResidual(). The owner is null for the
+    // z's that are not state variables of a Component (e.g., of a Measure).
+    SimTK::ResetOnCopy<std::vector<std::pair<const Component*, std::string>>>
+        _auxiliaryStateOwners;
+
 
     //                          VISUALIZATION
     // Anyone generating display geometry from this Model should consult this
@@ -0,0 +1,220 @@
+/* -------------------------------------------------------------------------- *
+ *                        OpenSim:  ModelCache.cpp                            *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2019 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "ModelCache.h"
+#include "Model.h"
+
+#include <OpenSim/Common/About.h>
+#include <OpenSim/Common/FileAdapter.h>
+#include <OpenSim/Common/IO.h>
+#include <OpenSim/Common/XMLDocument.h>
+
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+
+using namespace OpenSim;
+
+namespace {
+double secondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+}
+
+// 64-bit FNV-1a hash of the contents, in hexadecimal.
+std::string hashContents(const std::string& contents)
+{
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (const unsigned char c : contents) {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+    char hex[17];
+    std::snprintf(hex, sizeof(hex), "%016llx", (unsigned long long)hash);
+    return hex;
+}
+
+// The file name without its directory and extension.
+std::string getStem(const std::string& fileName)
+{
+    const size_t slash = fileName.find_last_of("/\\");
+    std::string stem = slash == std::string::npos ?
+            fileName : fileName.substr(slash + 1);
+    const size_t dot = stem.find_last_of('.');
+    if (dot != std::string::npos && dot > 0) stem.erase(dot);
+    return stem;
+}
+
+// Whether the element, or any element within it, includes another file
+// through a `file` attribute.
+bool includesFile(SimTK::Xml::Element element)
+{
+    if (element.hasAttribute("file")) return true;
+    for (auto it = element.element_begin(); it != element.element_end(); ++it)
+        if (includesFile(*it)) return true;
+    return false;
+}
+
+// The file format version of the document, as XMLDocument reads it.
+int getDocumentVersion(SimTK::Xml::Document& document)
+{
+    if (document.getRootTag() != "OpenSimDocument") return 10500;
+    return document.getRootElement()
+            .getOptionalAttributeValueAs<int>("Version", 10500);
+}
+
+// A suffix that no other thread or process writing to the cache uses.
+std::string getUniqueSuffix()
+{
+    std::random_device device;
+    std::uniform_int_distribution<unsigned long long> distribution;
+    char hex[17];
+    std::snprintf(hex, sizeof(hex), "%016llx", distribution(device));
+    return hex;
+}
+
+// Read the Model from the copy of the model file as if it had been read from
+// the model file: the Model is finalized only once its input file name is
+// that of the model file, so that the files it refers to (e.g., the meshes
+// of its geometry) are found relative to the model file, not to the cache.
+std::unique_ptr<Model> readCopy(const std::string& cacheFile,
+                                const std::string& modelPath)
+{
+    XMLDocument document(cacheFile);
+    std::unique_ptr<Model> model(new Model());
+    {
+        ScopedBaseDirectory directoryOfModelFile(
+                IO::getParentDirectory(modelPath));
+        SimTK::Xml::Element element = document.getRootDataElement();
+        model->updateFromXMLNode(element, document.getDocumentVersion());
+    }
+    model->setInputFileName(modelPath);
+    model->finalizeFromProperties();
+    return model;
+}
+
+// The version of OpenSim and of its file format, usable in a file name.
+std::string getVersionTag()
+{
+    std::string tag = GetVersion() + "_" +
+            std::to_string(XMLDocument::getLatestVersion());
+    for (char& c : tag)
+        if (!std::isalnum((unsigned char)c) && c != '.' && c != '-') c = '_';
+    return tag;
+}
+}
+
+ModelCache::ModelCache(const std::string& directory) :
+        _directory(directory.empty() ? "." : directory) {
+    // Fails harmlessly if the directory exists; writing copies to a
+    // directory that cannot be created fails in load().
+    IO::makeDir(_directory);
+}
+
+//_____________________________________________________________________________
+/**
+ * Read the model file to find the name of its copy, then read the copy if
+ * it exists. Otherwise, or if the copy cannot be read, read the model file
+ * and write the copy, first to a file with a random suffix and then
+ * renamed, so that a partly written copy is never read.
+ */
+std::unique_ptr<Model> ModelCache::load(const std::string& modelFile)
+{
+    _stats = LoadStats();
+    auto start = std::chrono::steady_clock::now();
+
+    const std::string path = IO::resolvePath(modelFile);
+    std::ifstream in(path, std::ios::in | std::ios::binary);
+    OPENSIM_THROW_IF(!in.good(), FileDoesNotExist, modelFile);
+    std::ostringstream contents;
+    contents << in.rdbuf();
+    const std::string& text = contents.str();
+    // A model file that cannot be parsed is left to Model to report.
+    bool cacheable = false;
+    try {
+        SimTK::Xml::Document document;
+        document.readFromString(text);
+        if (includesFile(document.getRootElement())) {
+            _stats.skipReason = "it includes other files";
+        } else if (getDocumentVersion(document) >=
+                XMLDocument::getLatestVersion()) {
+            _stats.skipReason = "it is already in the latest file format";
+        } else {
+            cacheable = true;
+        }
+    } catch (const std::exception&) {
+        _stats.skipReason = "it could not be parsed";
+    }
+    if (cacheable) {
+        _stats.cacheFile = _directory + "/" + getStem(path) + "_" +
+                hashContents(text) + "_" + getVersionTag() + ".osim";
+    }
+    _stats.hashTime = secondsSince(start);
+
+    std::unique_ptr<Model> model;
+    start = std::chrono::steady_clock::now();
+    if (cacheable && std::ifstream(IO::resolvePath(_stats.cacheFile)).good()) {
+        try {
+            model = readCopy(_stats.cacheFile, path);
+            _stats.cacheHit = true;
+        } catch (const std::exception& e) {
+            std::cout << "WARNING: ModelCache could not read "
+                      << _stats.cacheFile << "; it will be written again.\n"
+                      << "(details: " << e.what() << ")." << std::endl;
+        }
+    }
+    if (!model) model.reset(new Model(modelFile));
+    _stats.loadTime = secondsSince(start);
+
+    if (cacheable && !_stats.cacheHit) {
+        start = std::chrono::steady_clock::now();
+        const std::string cachePath = IO::resolvePath(_stats.cacheFile);
+        const std::string partPath = cachePath + "." + getUniqueSuffix();
+        // The Model was loaded; failing to cache it only costs time later.
+        try {
+            model->print(partPath);
+            std::remove(cachePath.c_str());
+            _stats.cacheWritten =
+                    std::rename(partPath.c_str(), cachePath.c_str()) == 0;
+        } catch (const std::exception& e) {
+            std::cout << "WARNING: ModelCache could not write "
+                      << _stats.cacheFile << " (details: " << e.what()
+                      << ")." << std::endl;
+        }
+        if (!_stats.cacheWritten) std::remove(partPath.c_str());
+        _stats.writeTime = secondsSince(start);
+    }
+
+    std::cout << "ModelCache: " << (_stats.cacheHit ? "read " : "loaded ")
+              << modelFile << (_stats.cacheHit ? " from its copy" : "")
+              << " in " << _stats.hashTime + _stats.loadTime << " s"
+              << (_stats.cacheWritten ? "; wrote " + _stats.cacheFile : "")
+              << (cacheable ? "" : "; not cached, since " + _stats.skipReason)
+              << "." << std::endl;
+    return model;
+}
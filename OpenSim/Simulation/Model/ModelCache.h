@@ -0,0 +1,102 @@
+#ifndef OPENSIM_MODEL_CACHE_H_
+#define OPENSIM_MODEL_CACHE_H_
+/* -------------------------------------------------------------------------- *
+ *                        OpenSim:  ModelCache.h                              *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2019 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include <memory>
+#include <string>
+
+#include <OpenSim/Simulation/osimSimulationDLL.h>
+
+namespace OpenSim {
+
+class Model;
+
+/** A ModelCache keeps, in a directory, a copy of each model file it loads
+as it is written by this version of OpenSim, so that the model can later be
+loaded from the copy. The copy is named after a hash of the contents of the
+model file and after the version of OpenSim. A model file that is edited, or
+that is loaded by another version of OpenSim, therefore gets a new copy;
+copies that are no longer used are not deleted.
+
+Loading from the copy skips the updates of older file formats, which edit
+the XML while it is read, and lets the independent sets of the model be read
+concurrently (see Object::getPropertiesToReadConcurrently()). The Model is
+otherwise the same as the one read from the model file, and its input file
+name (Model::getInputFileName()) is that of the model file, so that its
+geometry files are found as usual. If the copy cannot be read, it is written
+again from the model file.
+
+Model files that are already in the latest file format are loaded from the
+model file and are not cached, since their copy would be read no faster.
+Neither are model files that include other files (through a \c file
+attribute on any element), since changes to the included files would not
+change the hash. LoadStats::skipReason says why a model file was not
+cached.
+
+@code
+ModelCache cache("modelcache");
+std::unique_ptr<Model> model = cache.load("gait2392_simbody.osim");
+std::cout << cache.getLastLoadStats().loadTime << std::endl;
+@endcode */
+class OSIMSIMULATION_API ModelCache {
+public:
+    /** What load() did, and how long it took, in seconds. */
+    struct LoadStats {
+        /** The copy in the cache, or empty if the model file is not
+        cached. */
+        std::string cacheFile;
+        /** Why the model file is not cached, or empty if it is. */
+        std::string skipReason;
+        /** Whether the Model was read from the copy. */
+        bool cacheHit = false;
+        /** Whether the copy was (re)written. */
+        bool cacheWritten = false;
+        /** Reading and hashing the model file. */
+        double hashTime = 0;
+        /** Constructing the Model, from the copy or the model file. */
+        double loadTime = 0;
+        /** Writing the copy. */
+        double writeTime = 0;
+    };
+
+    /** Keep the copies in `directory`, which is created if it does not
+    exist. */
+    explicit ModelCache(const std::string& directory);
+
+    const std::string& getDirectory() const { return _directory; }
+
+    /** Load the model file, from its copy if there is one. The System of
+    the Model is not initialized. */
+    std::unique_ptr<Model> load(const std::string& modelFile);
+
+    /** What the last call to load() did. */
+    const LoadStats& getLastLoadStats() const { return _stats; }
+
+private:
+    std::string _directory;
+    LoadStats _stats;
+};
+
+} // namespace OpenSim
+
+#endif // OPENSIM_MODEL_CACHE_H_
@@ -0,0 +1,113 @@
+/* -------------------------------------------------------------------------- *
+ *                       OpenSim:  ModelTemplate.cpp                          *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2019 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "ModelTemplate.h"
+#include "Model.h"
+
+#include <algorithm>
+#include <exception>
+#include <thread>
+
+using namespace OpenSim;
+
+ModelTemplate::ModelTemplate(const std::string& modelFile) :
+        _model(new Model(modelFile)) {
+    initialize();
+}
+
+ModelTemplate::ModelTemplate(const Model& model) : _model(model.clone()) {
+    initialize();
+}
+
+ModelTemplate::ModelTemplate(ModelTemplate&&) = default;
+ModelTemplate& ModelTemplate::operator=(ModelTemplate&&) = default;
+ModelTemplate::~ModelTemplate() = default;
+
+//_____________________________________________________________________________
+/**
+ * Build the System of the template's model and assemble its initial state.
+ * This is the only assembly done for the template and all its instances.
+ */
+void ModelTemplate::initialize()
+{
+    _model->initSystem();
+}
+
+const SimTK::State& ModelTemplate::getInitialState() const
+{
+    return _model->getWorkingState();
+}
+
+//_____________________________________________________________________________
+/**
+ * Copy the template's model and initialize the copy from the template's
+ * initial state. Only const methods of the template's model are used, so
+ * several threads may create instances at once.
+ */
+std::unique_ptr<Model> ModelTemplate::createInstance() const
+{
+    std::unique_ptr<Model> instance(_model->clone());
+    instance->initSystem(getInitialState());
+    return instance;
+}
+
+//_____________________________________________________________________________
+/**
+ * Create the instances in contiguous chunks, one per thread. The calling
+ * thread creates the first chunk. If creating an instance throws, the first
+ * exception is rethrown once all the threads have finished.
+ */
+std::vector<std::unique_ptr<Model>> ModelTemplate::createInstances(
+        int numInstances, int numThreads) const
+{
+    std::vector<std::unique_ptr<Model>> instances(std::max(numInstances, 0));
+    if (numThreads <= 0)
+        numThreads = std::max(1, (int)std::thread::hardware_concurrency());
+    numThreads = std::min(numThreads, (int)instances.size());
+    if (numThreads <= 1) {
+        for (auto& instance : instances)
+            instance = createInstance();
+        return instances;
+    }
+
+    std::vector<std::exception_ptr> errors(numThreads);
+    auto createChunk = [&](int k) {
+        const int first = (k * numInstances) / numThreads;
+        const int last = ((k + 1) * numInstances) / numThreads;
+        try {
+            for (int i = first; i < last; ++i)
+                instances[i] = createInstance();
+        } catch (...) {
+            errors[k] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int k = 1; k < numThreads; ++k)
+        threads.emplace_back(createChunk, k);
+    createChunk(0);
+    for (auto& thread : threads) thread.join();
+
+    for (const auto& error : errors)
+        if (error) std::rethrow_exception(error);
+    return instances;
+}
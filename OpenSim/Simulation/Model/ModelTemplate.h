@@ -0,0 +1,95 @@
+#ifndef OPENSIM_MODEL_TEMPLATE_H_
+#define OPENSIM_MODEL_TEMPLATE_H_
+/* -------------------------------------------------------------------------- *
+ *                        OpenSim:  ModelTemplate.h                           *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2019 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <OpenSim/Simulation/osimSimulationDLL.h>
+
+namespace SimTK {
+class State;
+}
+
+namespace OpenSim {
+
+class Model;
+
+/** A ModelTemplate loads and initializes a Model once and then creates any
+number of independent, initialized copies ("instances") of it, for example
+one per thread or one per request of a long-running process.
+
+Loading a model file and assembling the model are done only by the
+template. Each instance is a copy of the template's Model whose System is
+built and whose working state is initialized from the template's assembled
+state (see Model::initSystem(const SimTK::State&)), so creating an instance
+costs a copy of the properties and the construction of the System, but
+neither XML parsing nor assembly.
+
+Instances are fully independent of each other and of the template: they may
+be modified, and used by different threads at the same time.
+createInstance() may be called by several threads at once.
+
+@code
+ModelTemplate arm("arm26.osim");
+std::vector<std::unique_ptr<Model>> models = arm.createInstances(8);
+// models[i]->getWorkingState() is ready to be used.
+@endcode */
+class OSIMSIMULATION_API ModelTemplate {
+public:
+    /** Load the model file and initialize its System. */
+    explicit ModelTemplate(const std::string& modelFile);
+
+    /** Make the template from a copy of `model`, whose System is initialized
+    by the template. `model` itself is not modified. */
+    explicit ModelTemplate(const Model& model);
+
+    ModelTemplate(ModelTemplate&&);
+    ModelTemplate& operator=(ModelTemplate&&);
+    ~ModelTemplate();
+
+    /** The Model from which the instances are copied. */
+    const Model& getModel() const { return *_model; }
+
+    /** The assembled initial state that the instances start from. */
+    const SimTK::State& getInitialState() const;
+
+    /** Create an instance. Its working state (Model::getWorkingState()) is a
+    copy of getInitialState(). */
+    std::unique_ptr<Model> createInstance() const;
+
+    /** Create `numInstances` instances using `numThreads` threads. If
+    `numThreads` is 0, as many threads as hardware threads are used. */
+    std::vector<std::unique_ptr<Model>> createInstances(int numInstances,
+            int numThreads = 0) const;
+
+private:
+    void initialize();
+
+    std::unique_ptr<Model> _model;
+};
+
+} // namespace OpenSim
+
+#endif // OPENSIM_MODEL_TEMPLATE_H_
@@ -28,6 +28,7 @@
 
 #include "GeometryPath.h"
 #include "Model.h"
+#include <OpenSim/Common/ComponentProfiler.h>
 #include <OpenSim/Common/XMLDocument.h>
 
 //=============================================================================
@@ -553,6 +554,7 @@ getMuscleDynamicsInfo(const SimTK::State& s) const
 {
     if(!isCacheVariableValid(s,"dynamicsInfo")){
         MuscleDynamicsInfo& umdi = updMuscleDynamicsInfo(s);
+        ComponentProfiler::Scope scope(*this, "calcMuscleDynamicsInfo");
         calcMuscleDynamicsInfo(s, umdi);
         markCacheVariableValid(s,"dynamicsInfo");
         // don't bother fishing it out of the cache since 
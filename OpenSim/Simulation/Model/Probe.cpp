@@ -28,14 +28,16 @@ using namespace std;
 using namespace SimTK;
 
 
-//This Measure returns a probe value only at the Acceleration stage
+//This Measure returns the probe inputs only at the Acceleration stage. The
+//inputs are computed once per realization and cached, however many of them
+//the probe has.
 template <class T>
 class ProbeMeasure : public SimTK::Measure_<T> {
 public:
     SimTK_MEASURE_HANDLE_PREAMBLE(ProbeMeasure, Measure_<T>);
  
-    ProbeMeasure(Subsystem& sub, const OpenSim::Probe& probe, int index)
-    :   SimTK::Measure_<T>(sub, new Implementation(probe, index), AbstractMeasure::SetHandle()) {}
+    ProbeMeasure(Subsystem& sub, const OpenSim::Probe& probe)
+    :   SimTK::Measure_<T>(sub, new Implementation(probe), AbstractMeasure::SetHandle()) {}
     SimTK_MEASURE_HANDLE_POSTSCRIPT(ProbeMeasure, Measure_<T>);
 };
  
@@ -43,8 +45,8 @@ public:
 template <class T>
 class ProbeMeasure<T>::Implementation : public SimTK::Measure_<T>::Implementation {
 public:
-    Implementation(const OpenSim::Probe& probe, int index)
-    :   SimTK::Measure_<T>::Implementation(1), m_probe(probe), i(index) {}
+    Implementation(const OpenSim::Probe& probe)
+    :   SimTK::Measure_<T>::Implementation(1), m_probe(probe) {}
  
     // Default copy constructor, destructor, copy assignment are fine.
  
@@ -74,19 +76,53 @@ public:
     
 private:
     const OpenSim::Probe& m_probe;
-    int i;
 };
 
 
-template <>
-void ProbeMeasure<double>::Implementation::calcCachedValueVirtual(const State& s, int derivOrder, double& value) const
-{
-    SimTK_ASSERT1_ALWAYS(derivOrder==0,
-        "ProbeMeasure::Implementation::calcCachedValueVirtual():"
-        " derivOrder %d seen but only 0 allowed.", derivOrder);
- 
-    value = m_probe.computeProbeInputs(s)(i);
-}
+//This Measure returns one element of the vector-valued ProbeMeasure, so that
+//the scalar operations (integrate, minimum, ...) can be applied to each probe
+//input without computing all the inputs again for every element.
+class ProbeInputMeasure : public SimTK::Measure_<double> {
+public:
+    SimTK_MEASURE_HANDLE_PREAMBLE(ProbeInputMeasure, Measure_<double>);
+
+    ProbeInputMeasure(Subsystem& sub, const Measure_<Vector>& inputs, int index)
+    :   SimTK::Measure_<double>(sub, new Implementation(inputs, index), AbstractMeasure::SetHandle()) {}
+    SimTK_MEASURE_HANDLE_POSTSCRIPT(ProbeInputMeasure, Measure_<double>);
+};
+
+
+class ProbeInputMeasure::Implementation : public SimTK::Measure_<double>::Implementation {
+public:
+    Implementation(const Measure_<Vector>& inputs, int index)
+    :   SimTK::Measure_<double>::Implementation(1), m_inputs(inputs), i(index) {}
+
+    Implementation* cloneVirtual() const override {
+        return new Implementation(*this);
+    }
+
+    int getNumTimeDerivativesVirtual() const override {
+        return 0;
+    }
+
+    Stage getDependsOnStageVirtual(int order) const override {
+        return Stage::Acceleration;
+    }
+
+    void calcCachedValueVirtual(const State& s, int derivOrder, double& value) const
+        override
+    {
+        SimTK_ASSERT1_ALWAYS(derivOrder==0,
+            "ProbeInputMeasure::Implementation::calcCachedValueVirtual():"
+            " derivOrder %d seen but only 0 allowed.", derivOrder);
+
+        value = m_inputs.getValue(s)[i];
+    }
+
+private:
+    Measure_<Vector> m_inputs;
+    int i;
+};
 
 
 namespace OpenSim {
@@ -153,19 +189,19 @@ void Probe::extendAddToSystem(MultibodySystem& system) const
     Probe* mutableThis = const_cast<Probe*>(this);
 
     // ---------------------------------------------------------------------
-    // Create a <double> Measure of the value to be probed (operand).
-    // For now, this is scalarized, i.e. a separate Measure is created
-    // for each probe input element in the Vector.
+    // Create a <Vector> Measure of the values to be probed, which computes
+    // all the probe inputs once per realization. The operations are
+    // scalarized, i.e. a separate <double> Measure is created for each
+    // probe input element in the Vector, which only reads its element.
     // ---------------------------------------------------------------------
-    // save for when we can directly operate on Vector SimTK::Measures
-    //ProbeMeasure<SimTK::Vector> beforeOperationValueVector(system, *this);
+    ProbeMeasure<SimTK::Vector> beforeOperationValueVector(system, *this);
 
     int npi = getNumProbeInputs();
-    SimTK::Array_<ProbeMeasure<double> > beforeOperationValues;
+    SimTK::Array_<ProbeInputMeasure> beforeOperationValues;
     mutableThis->afterOperationValues.resize(npi);
 
     for (int i=0; i<npi; ++i) {
-        ProbeMeasure<double> tmpPM(system, *this, i); 
+        ProbeInputMeasure tmpPM(system, beforeOperationValueVector, i); 
         beforeOperationValues.push_back(tmpPM);
     }
 
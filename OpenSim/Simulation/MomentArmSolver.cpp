@@ -45,6 +45,56 @@ MomentArmSolver::MomentArmSolver(const Model &model) : Solver(model)
         .getRigidBodyForces(_stateCopy, Stage::Instance);
     // get the right size coupling vector
     _coupling = _stateCopy.getU();
+
+    findCoupledMobilities();
+}
+
+//______________________________________________________________________________
+/**
+ * Mark the mobilities that enabled constraints of the model act on. These
+ * are the mobilities of the constrained mobilizers and of the mobilizers
+ * between each constrained body and the ancestor body of the constraint.
+ * Constraints are only ever disabled in the copy of the state (by unlocking
+ * the coordinate of interest), so this set does not grow afterwards.
+ */
+void MomentArmSolver::findCoupledMobilities()
+{
+    const SimbodyMatterSubsystem& matter = getModel().getMatterSubsystem();
+    const State& s = _stateCopy;
+
+    _isCoupled.assign(s.getNU(), false);
+    auto markMobilities = [&](const MobilizedBody& mobod) {
+        const int first = mobod.getFirstUIndex(s);
+        for (int i = 0; i < mobod.getNumU(s); ++i)
+            _isCoupled[first + i] = true;
+    };
+
+    for (ConstraintIndex cx(0); cx < matter.getNumConstraints(); ++cx) {
+        const SimTK::Constraint& constraint = matter.getConstraint(cx);
+        if (constraint.isDisabled(s))
+            continue;
+
+        for (ConstrainedMobilizerIndex cmx(0);
+                cmx < constraint.getNumConstrainedMobilizers(); ++cmx)
+            markMobilities(
+                constraint.getMobilizedBodyFromConstrainedMobilizer(cmx));
+
+        const MobilizedBodyIndex ancestor =
+            constraint.getAncestorMobilizedBody().getMobilizedBodyIndex();
+        for (ConstrainedBodyIndex cbx(0);
+                cbx < constraint.getNumConstrainedBodies(); ++cbx) {
+            const MobilizedBody* mobod =
+                &constraint.getMobilizedBodyFromConstrainedBody(cbx);
+            while (!mobod->isGround() &&
+                    mobod->getMobilizedBodyIndex() != ancestor) {
+                markMobilities(*mobod);
+                mobod = &mobod->getParentMobilizedBody();
+            }
+        }
+    }
+
+    _couplingCache.assign(s.getNU(), Vector());
+    _couplingQ.clear();
 }
 
 /*********************************************************************************
@@ -66,7 +116,7 @@ double MomentArmSolver::solve(const State &state, const Coordinate &aCoord,
     s_ma.updQ() = state.getQ();
 
     // compute the coupling between coordinates due to constraints
-    _coupling = computeCouplingVector(s_ma, aCoord);
+    const Vector& coupling = computeCouplingVector(s_ma, aCoord);
 
     // set speeds to zero
     s_ma.updU() = 0;
@@ -90,7 +140,7 @@ double MomentArmSolver::solve(const State &state, const Coordinate &aCoord,
     // Moment-arm is the effective torque (since tension is 1) at the 
     // coordinate of interest taking into account the generalized forces also 
     // acting on other coordinates that are coupled via constraint.
-    return ~_coupling*_generalizedForces;
+    return ~coupling*_generalizedForces;
 }
 
 
@@ -105,7 +155,7 @@ double MomentArmSolver::solve(const State &state, const Coordinate &aCoord,
     s_ma.updQ() = state.getQ();
 
     // compute the coupling between coordinates due to constraints
-    _coupling = computeCouplingVector(s_ma, aCoord);
+    const Vector& coupling = computeCouplingVector(s_ma, aCoord);
 
     // set speeds to zero
     s_ma.updU() = 0;
@@ -129,32 +179,73 @@ double MomentArmSolver::solve(const State &state, const Coordinate &aCoord,
     // Moment-arm is the effective torque (since tension is 1) at the 
     // coordinate of interest taking into account the generalized forces also 
     // acting on other coordinates that are coupled via constraint.
-    return ~_coupling*_generalizedForces;
+    return ~coupling*_generalizedForces;
 }
 
-SimTK::Vector MomentArmSolver::computeCouplingVector(SimTK::State &state, 
-        const Coordinate &coordinate) const
+//______________________________________________________________________________
+/**
+ * Compute the change in all the speeds due to a unit speed of the coordinate,
+ * with the constraints satisfied. For a coordinate that no constraint acts
+ * on, this is a unit vector. Otherwise the speeds are projected onto the
+ * constraints, and the result is kept until the generalized coordinates of
+ * the state change. In either case the state is realized to Position.
+ */
+const SimTK::Vector& MomentArmSolver::computeCouplingVector(
+        SimTK::State &state, const Coordinate &coordinate) const
 {
-    // make sure copy of the state is realized to at least instance
-    getModel().getMultibodySystem().realize(state, SimTK::Stage::Instance);
-
-    // unlock the coordinate if it is locked
-    coordinate.setLocked(state, false);
-
-    // Calculate coupling matrix C to determine the influence of other coordinates 
-    // (mobilities) on the coordinate of interest due to constraints
-    state.updU() = 0;
-    // Light-up speed of coordinate of interest and see how other coordinates
-    // affected by constraints respond
-    coordinate.setSpeedValue(state, 1);
-    getModel().getMultibodySystem().realize(state, SimTK::Stage::Velocity);
-
-    // Satisfy all the velocity constraints.
-    getModel().getMultibodySystem().projectU(state, 1e-10);
-    
-    // Now calculate C. by checking how speeds of other coordinates change
-    // normalized by how much the speed of the coordinate of interest changed 
-    return state.getU() / coordinate.getSpeedValue(state);
+    const MultibodySystem& system = getModel().getMultibodySystem();
+
+    // unlock the coordinate if it is locked; this changes the coupling of
+    // the coordinates it is coupled to, so forget the cached vectors
+    if (coordinate.getLocked(state)) {
+        coordinate.setLocked(state, false);
+        for (auto& cached : _couplingCache)
+            cached.clear();
+    }
+
+    // make sure copy of the state is realized to at least position
+    system.realize(state, SimTK::Stage::Position);
+
+    const MobilizedBody& mobod = getModel().getMatterSubsystem()
+        .getMobilizedBody(coordinate.getBodyIndex());
+    const int u = mobod.getFirstUIndex(state) + coordinate.getMobilizerQIndex();
+
+    if (!_isCoupled[u]) {
+        _coupling = 0;
+        _coupling[u] = 1;
+        return _coupling;
+    }
+
+    const Vector& q = state.getQ();
+    bool sameQ = _couplingQ.size() == q.size();
+    for (int i = 0; sameQ && i < q.size(); ++i)
+        sameQ = _couplingQ[i] == q[i];
+    if (!sameQ) {
+        for (auto& cached : _couplingCache)
+            cached.clear();
+        _couplingQ = q;
+    }
+
+    Vector& coupling = _couplingCache[u];
+    if (coupling.size() == 0) {
+        // Calculate coupling matrix C to determine the influence of other
+        // coordinates (mobilities) on the coordinate of interest due to
+        // constraints
+        state.updU() = 0;
+        // Light-up speed of coordinate of interest and see how other
+        // coordinates affected by constraints respond
+        coordinate.setSpeedValue(state, 1);
+        system.realize(state, SimTK::Stage::Velocity);
+
+        // Satisfy all the velocity constraints.
+        system.projectU(state, 1e-10);
+
+        // Now calculate C. by checking how speeds of other coordinates change
+        // normalized by how much the speed of the coordinate of interest
+        // changed
+        coupling = state.getU() / coordinate.getSpeedValue(state);
+    }
+    return coupling;
 }
 
 } // end of namespace OpenSim
@@ -25,6 +25,7 @@
 
 #include "Solver.h"
 #include "SimTKcommon/internal/State.h"
+#include <vector>
 
 namespace OpenSim {
 
@@ -96,8 +97,22 @@ private:
     // Keep preallocated vector of the coupling constraint factors
     mutable SimTK::Vector _coupling;
 
+    // Whether each mobility is affected by an enabled constraint, found once
+    // from the constraints of the model. The coupling vector of a mobility
+    // that is not is a unit vector and needs no projection.
+    std::vector<bool> _isCoupled;
+
+    // Coupling vectors of the coupled mobilities, indexed by mobility and
+    // computed at the generalized coordinates _couplingQ. An empty vector
+    // has not been computed yet.
+    mutable std::vector<SimTK::Vector> _couplingCache;
+    mutable SimTK::Vector _couplingQ;
+
+    // find the mobilities that are coupled by constraints
+    void findCoupledMobilities();
+
     // compute vector of constraint coupling factors
-    SimTK::Vector computeCouplingVector(SimTK::State &state, 
+    const SimTK::Vector& computeCouplingVector(SimTK::State &state, 
         const Coordinate &coordinate) const;
 //=============================================================================
 };  // END of class MomentArmSolver
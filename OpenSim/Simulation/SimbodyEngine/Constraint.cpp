@@ -28,6 +28,9 @@
 #include <OpenSim/Simulation/Model/Model.h>
 #include "simbody/internal/Constraint.h"
 
+#include <algorithm>
+#include <set>
+
 //=============================================================================
 // STATICS
 //=============================================================================
@@ -268,36 +271,76 @@ Array<std::string> Constraint::getRecordLabels() const
  * location frame, etc. used in conjunction with getRecordLabels and should return same size Array
  */
 Array<double> Constraint::getRecordValues(const SimTK::State& state) const
+{
+    const SimTK::Constraint& simConstraint =
+        _model->getMatterSubsystem().getConstraint(_index);
+    Array<double> values(0.0, 6*simConstraint.getNumConstrainedBodies() +
+                              simConstraint.getNumConstrainedU(state));
+    fillConstraintForceRecordValues(state, values.get(), values.getSize());
+    return values;
+}
+
+/**
+ * The Constraints of this library do not override getRecordValues(), so their
+ * values are written without allocating. A Constraint of any other class,
+ * including a subclass of these, may override getRecordValues(), so its
+ * values are copied from it.
+ */
+void Constraint::fillRecordValues(const SimTK::State& state,
+                                  double* values, int numValues) const
+{
+    static const std::set<std::string> builtInConstraints{
+        "WeldConstraint", "PointConstraint", "ConstantDistanceConstraint",
+        "CoordinateCouplerConstraint", "PointOnLineConstraint",
+        "RollingOnSurfaceConstraint"};
+    if (builtInConstraints.count(getConcreteClassName())) {
+        fillConstraintForceRecordValues(state, values, numValues);
+        return;
+    }
+
+    const Array<double> recordValues = getRecordValues(state);
+    const int n = std::min(numValues, recordValues.getSize());
+    std::copy(recordValues.get(), recordValues.get() + n, values);
+    std::fill(values + n, values + numValues, SimTK::NaN);
+}
+
+void Constraint::fillConstraintForceRecordValues(const SimTK::State& state,
+        double* values, int numValues) const
 {
     // EOMs are solved for accelerations (udots) and constraint multipliers (lambdas)
     // simultaneously, so system must be realized to acceleration
     _model->getMultibodySystem().realize(state, SimTK::Stage::Acceleration);
-    SimTK::Constraint& simConstraint = _model->updMatterSubsystem().updConstraint(_index);
+    const SimTK::Constraint& simConstraint =
+        _model->getMatterSubsystem().getConstraint(_index);
 
     // number of bodies being directly constrained
     int ncb = simConstraint.getNumConstrainedBodies();
     // number of mobilities being directly constrained
     int ncm = simConstraint.getNumConstrainedU(state);
 
-    SimTK::Vector_<SimTK::SpatialVec> bodyForcesInAncestor(ncb);
+    // Scratch space reused across calls; resize() does not allocate once the
+    // vectors have grown to the largest constraint reported by this thread.
+    thread_local SimTK::Vector_<SimTK::SpatialVec> bodyForcesInAncestor;
+    thread_local SimTK::Vector mobilityForces;
+    bodyForcesInAncestor.resize(ncb);
     bodyForcesInAncestor.setToZero();
-    SimTK::Vector mobilityForces(ncm, 0.0);
-
-    Array<double> values(0.0,6*ncb+ncm);
+    mobilityForces.resize(ncm);
+    mobilityForces.setToZero();
 
     calcConstraintForces(state, bodyForcesInAncestor, mobilityForces);
-    
-    for(int i=0; i<ncb; ++i){
-        for(int j=0; j<3; ++j){
-            // Simbody constraints have reaction moments first and OpenSim reports forces first
-            // so swap them here
-            values[i*6+j] = (bodyForcesInAncestor(i)[1])[j]; // moments on constrained body i
-            values[i*6+3+j] = (bodyForcesInAncestor(i)[0])[j]; // forces on constrained body i
+
+    const int n = std::min(numValues, 6*ncb+ncm);
+    for(int k=0; k<n; ++k){
+        if(k < 6*ncb){
+            // Simbody constraints have reaction moments first and OpenSim
+            // reports forces first so swap them here
+            const int i = k/6, j = k%6;
+            values[k] = j < 3 ? (bodyForcesInAncestor(i)[1])[j]    // forces
+                              : (bodyForcesInAncestor(i)[0])[j-3]; // moments
+        }
+        else{
+            values[k] = mobilityForces[k-6*ncb];
         }
     }
-    for(int i=0; i<ncm; ++i){
-        values[6*ncb+i] = mobilityForces[i];
-    }
-
-    return values;
-};
+    std::fill(values + n, values + numValues, SimTK::NaN);
+}
@@ -95,6 +95,15 @@ public:
      * conjunction with getRecordLabels() and must return an Array of equal
      * size. */
     virtual Array<double> getRecordValues(const SimTK::State& state) const;
+    /**
+     * Write the values of getRecordValues() into the caller's buffer
+     * `values` of `numValues` entries (the number of record labels). The
+     * default implementation copies the result of getRecordValues()
+     * (padding with NaN if it is short), except for the Constraints of this
+     * library, which report the default values and so write them with
+     * fillConstraintForceRecordValues(), which does not allocate. */
+    virtual void fillRecordValues(const SimTK::State& state,
+                                  double* values, int numValues) const;
 
     /**
     * This method specifies the interface that a constraint must implement
@@ -107,6 +116,12 @@ public:
     }
 
 protected:
+    /** Write the values that the default getRecordValues() reports (the
+    forces and moments on the constrained bodies and the forces on the
+    constrained mobilities) into `values` without allocating. */
+    void fillConstraintForceRecordValues(const SimTK::State& state,
+                                         double* values, int numValues) const;
+
     // ModelComponent interface.
     void extendConnectToModel(Model& aModel) override;
     void extendInitStateFromProperties(SimTK::State& state) const override;
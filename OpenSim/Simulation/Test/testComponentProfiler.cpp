@@ -0,0 +1,162 @@
+/* -------------------------------------------------------------------------- *
+ *                    OpenSim:  testComponentProfiler.cpp                     *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2019 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+/*=============================================================================
+
+ComponentProfiler Tests:
+1. testDisabledRecordsNothing: With the profiler off, simulating records no
+   entries.
+2. testRecordsComponentComputations: With the profiler on, forces, muscles,
+   paths and realizations of the arm26 model are recorded, grouped by path
+   and by type, and self time never exceeds total time.
+3. testChromeTrace: Trace events are written in the Chrome trace format.
+
+//=============================================================================*/
+#include <OpenSim/Common/ComponentProfiler.h>
+#include <OpenSim/Simulation/Model/Model.h>
+#include <OpenSim/Simulation/Manager/Manager.h>
+#include <OpenSim/Auxiliary/auxiliaryTestFunctions.h>
+
+#include <algorithm>
+#include <sstream>
+
+using namespace OpenSim;
+using namespace std;
+
+void testDisabledRecordsNothing();
+void testRecordsComponentComputations();
+void testChromeTrace();
+
+int main()
+{
+    SimTK_START_TEST("testComponentProfiler");
+        SimTK_SUBTEST(testDisabledRecordsNothing);
+        SimTK_SUBTEST(testRecordsComponentComputations);
+        SimTK_SUBTEST(testChromeTrace);
+    SimTK_END_TEST();
+}
+
+namespace {
+    void simulateArm(double finalTime) {
+        Model arm("arm26.osim");
+        SimTK::State& state = arm.initSystem();
+        arm.equilibrateMuscles(state);
+        Manager manager(arm);
+        manager.setPerformAnalyses(false);
+        manager.setWriteToStorage(false);
+        manager.initialize(state);
+        manager.integrate(finalTime);
+    }
+
+    const ComponentProfiler::Record* findRecord(
+            const vector<ComponentProfiler::Record>& records,
+            const string& name, const string& computation, bool byType) {
+        for (const auto& record : records) {
+            if ((byType ? record.type : record.path) == name &&
+                    record.computation == computation)
+                return &record;
+        }
+        return nullptr;
+    }
+}
+
+void testDisabledRecordsNothing()
+{
+    ComponentProfiler::reset();
+    ComponentProfiler::setEnabled(false);
+    simulateArm(0.01);
+    SimTK_TEST(ComponentProfiler::getRecords().empty());
+}
+
+void testRecordsComponentComputations()
+{
+    ComponentProfiler::reset();
+    ComponentProfiler::setEnabled(true);
+    simulateArm(0.05);
+    ComponentProfiler::setEnabled(false);
+
+    const auto byPath = ComponentProfiler::getRecords();
+    SimTK_TEST(!byPath.empty());
+
+    const auto* force = findRecord(byPath,
+            "/arm26/forceset/TRIlong", "computeForce", false);
+    SimTK_TEST(force != nullptr);
+    SimTK_TEST(force->numCalls > 0);
+    SimTK_TEST(force->type == "Thelen2003Muscle");
+
+    SimTK_TEST(findRecord(byPath, "/arm26/forceset/TRIlong",
+                          "calcMuscleDynamicsInfo", false) != nullptr);
+    SimTK_TEST(findRecord(byPath, "/arm26/forceset/TRIlong",
+                          "realizeAcceleration", false) != nullptr);
+
+    for (const auto& record : byPath) {
+        SimTK_TEST(record.selfTime <= record.totalTime + SimTK::Eps);
+        SimTK_TEST(record.maxTime <= record.totalTime + SimTK::Eps);
+    }
+
+    // Grouping by type sums the calls of all the muscles.
+    const auto byType = ComponentProfiler::getRecords(ComponentProfiler::ByType);
+    const auto* muscles = findRecord(byType,
+            "Thelen2003Muscle", "computeForce", true);
+    SimTK_TEST(muscles != nullptr);
+    SimTK_TEST(muscles->numCalls > force->numCalls);
+
+    const auto* paths = findRecord(byType, "GeometryPath", "computePath", true);
+    SimTK_TEST(paths != nullptr);
+    SimTK_TEST(paths->numCalls > 0);
+
+    std::ostringstream table;
+    ComponentProfiler::printTable(table, ComponentProfiler::ByType);
+    SimTK_TEST(table.str().find("Thelen2003Muscle") != string::npos);
+
+    // Records are sorted by decreasing self time.
+    SimTK_TEST(std::is_sorted(byPath.begin(), byPath.end(),
+            [](const ComponentProfiler::Record& a,
+               const ComponentProfiler::Record& b) {
+                return a.selfTime > b.selfTime;
+            }));
+}
+
+void testChromeTrace()
+{
+    ComponentProfiler::reset();
+    ComponentProfiler::setTracingEnabled(true, 100);
+    ComponentProfiler::setEnabled(true);
+    simulateArm(0.01);
+    ComponentProfiler::setEnabled(false);
+    ComponentProfiler::setTracingEnabled(false);
+
+    std::ostringstream trace;
+    ComponentProfiler::printChromeTrace(trace);
+    const string json = trace.str();
+    SimTK_TEST(json.find("{\"traceEvents\":[") == 0);
+    SimTK_TEST(json.find("\"ph\":\"X\"") != string::npos);
+
+    // No more than the requested number of events are kept.
+    size_t numEvents = 0;
+    for (size_t pos = json.find("\"ph\""); pos != string::npos;
+            pos = json.find("\"ph\"", pos + 1))
+        ++numEvents;
+    SimTK_TEST(numEvents == 100);
+
+    ComponentProfiler::reset();
+}
@@ -1247,6 +1247,15 @@ void testHuntCrossleyForce()
     ASSERT_EQUAL(contact_force[4], 0.0, 1e-4); // no torque on the ball
     ASSERT_EQUAL(contact_force[5], 0.0, 1e-4); // no torque on the ball
 
+    // Reporters fill preallocated rows with the same values.
+    double filled[6];
+    contact.fillRecordValues(osim_state, filled, 6);
+    for (int i = 0; i < 6; ++i)
+        ASSERT_EQUAL(contact_force[i], filled[i], 1e-12);
+    const Storage& forces = reporter->getForceStorage();
+    ASSERT(forces.getLastStateVector()->getSize() ==
+           forces.getColumnLabels().getSize() - 1);
+
     // Before exiting lets see if copying the force works
     OpenSim::HuntCrossleyForce *copyOfForce = contact.clone();
 
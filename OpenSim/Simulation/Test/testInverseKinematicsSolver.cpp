@@ -40,6 +40,8 @@ using namespace std;
 // Verify that the marker weight are consistent with the initial Set
 // of MarkerWeights used to construct the MarkersReference
 void testMarkersReference();
+// Verify the interpolation of marker values between frames and across gaps
+void testMarkersReferenceInterpolation();
 // Verify that the orientations sensor weights are consistent with the initial
 // Set of OrientationWeights used to construct the OrientationsReference
 void testOrientationsReference();
@@ -81,6 +83,9 @@ void testUpdateMarkerWeights();
 // Verify that the track() solution is also effected by updating marker
 // weights and marker error is being reduced as its weighting increases.
 void testTrackWithUpdateMarkerWeights();
+// Verify that tracking from extrapolated solutions and with a time budget
+// follows the markers and reports per-frame statistics.
+void testTrackingExtrapolationAndBudget();
 
 // Verify that solver does not confuse/mismanage markers when reference
 // has more markers than the model, order is changed or marker reference
@@ -97,6 +102,11 @@ int main()
         cout << e.what() << endl;
         failures.push_back("testMarkersReference");
     }
+    try { testMarkersReferenceInterpolation(); }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testMarkersReferenceInterpolation");
+    }
     try { testOrientationsReference(); }
     catch (const std::exception& e) {
         cout << e.what() << endl;
@@ -117,6 +127,12 @@ int main()
         failures.push_back("testTrackWithUpdateMarkerWeights");
     }
 
+    try { testTrackingExtrapolationAndBudget(); }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testTrackingExtrapolationAndBudget");
+    }
+
     try { testNumberOfMarkersMismatch(); }
     catch (const std::exception& e) {
         cout << e.what() << endl;
@@ -210,6 +226,63 @@ void testMarkersReference()
     }
 }
 
+void testMarkersReferenceInterpolation()
+{
+    // Marker "A" moves along x at 1 m/s; "B" follows it but is missing at
+    // 0.4 s and 0.5 s.
+    TimeSeriesTable_<SimTK::Vec3> markerData;
+    markerData.setColumnLabels({ "A", "B" });
+    for (int r = 0; r <= 10; ++r) {
+        const SimTK::Vec3 p(0.1*r, 0, 0);
+        SimTK::RowVector_<SimTK::Vec3> row(2, p);
+        if (r == 4 || r == 5) row[1] = SimTK::Vec3(SimTK::NaN);
+        markerData.appendRow(0.1*r, row);
+    }
+    MarkersReference markersRef(markerData);
+    SimTK::Array_<SimTK::Vec3> values;
+
+    // Nearest frame (the default).
+    markersRef.getValuesAtTime(0.26, values);
+    SimTK_ASSERT_ALWAYS(values.size() == 2 &&
+            std::abs(values[0][0] - 0.3) < SimTK::Eps,
+        "Expected the values of the nearest frame.");
+    SimTK_ASSERT_ALWAYS(
+            std::abs(markersRef.getNearestRowView(0.26)[0][0] - 0.3) <
+            SimTK::Eps, "Expected a view of the nearest frame.");
+
+    // Linear and cubic interpolation reproduce the straight trajectory, also
+    // when the queries go back in time.
+    for (auto interpolation : { MarkersReference::Linear,
+                                MarkersReference::Cubic }) {
+        markersRef.setInterpolation(interpolation);
+        for (double t : { 0.0, 0.25, 0.73, 1.0, 0.05, 0.97 }) {
+            markersRef.getValuesAtTime(t, values);
+            SimTK_ASSERT_ALWAYS(std::abs(values[0][0] - t) < 1e-12,
+                "Interpolated marker value does not match trajectory.");
+        }
+    }
+
+    // Gaps are NaN unless they are short enough to be filled.
+    markersRef.setInterpolation(MarkersReference::Linear);
+    markersRef.getValuesAtTime(0.45, values);
+    SimTK_ASSERT_ALWAYS(values[1].isNaN(), "Expected a gap.");
+    markersRef.getValuesAtTime(0.25, values);
+    SimTK_ASSERT_ALWAYS(std::abs(values[1][0] - 0.25) < 1e-12,
+        "Expected interpolation outside of the gap.");
+    markersRef.setMaxGapDuration(0.35);
+    for (double t : { 0.4, 0.45, 0.5, 0.55 }) {
+        markersRef.getValuesAtTime(t, values);
+        SimTK_ASSERT_ALWAYS(std::abs(values[1][0] - t) < 1e-12,
+            "Expected the gap to be filled.");
+    }
+    markersRef.setMaxGapDuration(0.2);
+    markersRef.getValuesAtTime(0.45, values);
+    SimTK_ASSERT_ALWAYS(values[1].isNaN(), "Expected the gap to be kept.");
+
+    SimTK_TEST_MUST_THROW_EXC(markersRef.getValuesAtTime(1.5, values),
+                              TimeOutOfRange);
+}
+
 void testOrientationsReference()
 {
     // column labels for orientation sensor data
@@ -347,6 +420,24 @@ void testAccuracy()
     cout << "For accuracy: " << looseAccuracy << "; Sum-squared Error: " 
         << looseSumSqError << endl;
 
+    // Locations and errors computed together match those computed separately.
+    SimTK::Array_<SimTK::Vec3> locations, locationsTogether;
+    SimTK::Array_<double> sqErrorsTogether;
+    ikSolver.computeCurrentMarkerLocations(locations);
+    ikSolver.computeCurrentMarkerLocationsAndSquaredErrors(
+            locationsTogether, sqErrorsTogether);
+    SimTK_ASSERT_ALWAYS(locationsTogether.size() == locations.size() &&
+            sqErrorsTogether.size() == sqMarkerErrors.size(),
+        "computeCurrentMarkerLocationsAndSquaredErrors() returned the wrong "
+        "number of markers.");
+    for (unsigned i = 0; i < locations.size(); ++i) {
+        SimTK_ASSERT_ALWAYS(
+            (locationsTogether[i] - locations[i]).norm() <= SimTK::Eps &&
+            std::abs(sqErrorsTogether[i] - sqMarkerErrors[i]) <= SimTK::Eps,
+            "computeCurrentMarkerLocationsAndSquaredErrors() differs from "
+            "computeCurrentMarkerLocations()/computeCurrentSquaredMarkerErrors().");
+    }
+
     // Reset the initial coordinate value
     coord.setValue(state, 0.0);
     ikSolver.setAccuracy(tightAccuracy);
@@ -570,6 +661,82 @@ void testTrackWithUpdateMarkerWeights()
     }
 }
 
+void testTrackingExtrapolationAndBudget()
+{
+    cout << "\ntestInverseKinematicsSolver::"
+            "testTrackingExtrapolationAndBudget()" << endl;
+    std::unique_ptr<Model> pendulum{ constructPendulumWithMarkers() };
+    Coordinate& coord = pendulum->getCoordinateSet()[0];
+    SimTK::State state = pendulum->initSystem();
+
+    // A smooth swing of the pendulum.
+    const double dt = 0.01;
+    const int numFrames = 101;
+    auto theta = [](double t) { return 0.5 * std::sin(4 * t); };
+    StatesTrajectory states;
+    for (int i = 0; i < numFrames; ++i) {
+        state.updTime() = i * dt;
+        coord.setValue(state, theta(i * dt));
+        states.append(state);
+    }
+    SimTK::RowVector_<SimTK::Vec3> biases(3, SimTK::Vec3(0));
+    MarkersReference markersRef(
+            generateMarkerDataFromModelAndStates(*pendulum, states, biases));
+    SimTK::Array_<CoordinateReference> coordRefs;
+
+    const double accuracy = 1e-8;
+    for (int order = 0; order <= 2; ++order) {
+        InverseKinematicsSolver ikSolver(*pendulum, markersRef, coordRefs);
+        ikSolver.setAccuracy(accuracy);
+        ikSolver.setTrackingExtrapolationOrder(order);
+        state.updTime() = 0;
+        coord.setValue(state, 0.0);
+        ikSolver.assemble(state);
+
+        int numGoalEvaluations = 0;
+        for (int i = 1; i < numFrames; ++i) {
+            state.updTime() = i * dt;
+            ikSolver.track(state);
+            const auto& stats = ikSolver.getTrackingStats();
+            SimTK_ASSERT_ALWAYS(stats.converged && stats.time >= 0 &&
+                    stats.numGoalEvaluations >= 0 && stats.goal >= 0,
+                "InverseKinematicsSolver track() reported invalid stats.");
+            numGoalEvaluations += stats.numGoalEvaluations;
+            SimTK_ASSERT_ALWAYS(
+                abs(coord.getValue(state) - theta(i * dt)) <= 1e-6,
+                "InverseKinematicsSolver track() from extrapolated solutions "
+                "failed to follow the markers.");
+        }
+        cout << "Extrapolation order " << order << ": "
+             << numGoalEvaluations << " goal evaluations." << endl;
+    }
+
+    // A budget too small for any refinement leaves the coarse solutions.
+    InverseKinematicsSolver ikSolver(*pendulum, markersRef, coordRefs);
+    ikSolver.setAccuracy(accuracy);
+    ikSolver.setTrackingExtrapolationOrder(2);
+    ikSolver.setTrackingTimeBudget(1e-12);
+    state.updTime() = 0;
+    coord.setValue(state, 0.0);
+    ikSolver.assemble(state);
+    int numConverged = 0;
+    for (int i = 1; i < numFrames; ++i) {
+        state.updTime() = i * dt;
+        ikSolver.track(state);
+        if (ikSolver.getTrackingStats().converged) ++numConverged;
+        SimTK_ASSERT_ALWAYS(
+            abs(coord.getValue(state) - theta(i * dt)) <= 1e-2,
+            "InverseKinematicsSolver track() with a time budget failed to "
+            "follow the markers.");
+    }
+    SimTK_ASSERT_ALWAYS(numConverged == 0,
+        "InverseKinematicsSolver track() refined despite its time budget.");
+
+    SimTK_TEST_MUST_THROW_EXC(ikSolver.setTrackingExtrapolationOrder(3),
+                              Exception);
+    SimTK_TEST_MUST_THROW_EXC(ikSolver.setTrackingTimeBudget(0), Exception);
+}
+
 void testNumberOfMarkersMismatch()
 {
     cout << 
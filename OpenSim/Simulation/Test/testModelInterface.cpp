@@ -21,17 +21,31 @@
  * -------------------------------------------------------------------------- */
 
 #include <OpenSim/Auxiliary/auxiliaryTestFunctions.h>
+#include <OpenSim/Actuators/Millard2012EquilibriumMuscle.h>
 #include <OpenSim/Simulation/Model/Model.h>
+#include <OpenSim/Simulation/Model/ModelCache.h>
+#include <OpenSim/Simulation/Model/ModelTemplate.h>
 #include <OpenSim/Simulation/Model/PhysicalOffsetFrame.h>
 #include <OpenSim/Simulation/SimbodyEngine/PinJoint.h>
+#include <OpenSim/Simulation/Model/PrescribedForce.h>
 #include <OpenSim/Simulation/Manager/Manager.h>
+#include <OpenSim/Common/FileAdapter.h>
+#include <OpenSim/Common/IO.h>
 #include <OpenSim/Common/LoadOpenSimLibrary.h>
 
+#include <fstream>
+#include <sstream>
+
 using namespace OpenSim;
 using namespace std;
 
 void testModelFinalizePropertiesAndConnections();
 void testModelTopologyErrors();
+void testCachedComponentLists();
+void testModelTemplate();
+void testImplicitResidual();
+void testReadSetsConcurrently();
+void testModelCache();
 
 int main() {
     LoadOpenSimLibrary("osimActuators");
@@ -39,6 +53,11 @@ int main() {
     SimTK_START_TEST("testModelInterface");
         SimTK_SUBTEST(testModelFinalizePropertiesAndConnections);
         SimTK_SUBTEST(testModelTopologyErrors);
+        SimTK_SUBTEST(testCachedComponentLists);
+        SimTK_SUBTEST(testModelTemplate);
+        SimTK_SUBTEST(testImplicitResidual);
+        SimTK_SUBTEST(testReadSetsConcurrently);
+        SimTK_SUBTEST(testModelCache);
     SimTK_END_TEST();
 }
 
@@ -227,3 +246,317 @@ void testModelTopologyErrors()
 
     ASSERT_THROW(JointFramesHaveSameBaseFrame, degenerate.initSystem());
 }
+
+// The cached lists must hold the same components, in the same order, as the
+// corresponding ComponentLists.
+template <typename T>
+void compareWithComponentList(const Model& model,
+                              const std::vector<const T*>& cached) {
+    size_t i = 0;
+    for (const T& comp : model.getComponentList<T>()) {
+        ASSERT(i < cached.size() && cached[i] == &comp, __FILE__, __LINE__,
+               "Cached " + T::getClassName() + " list differs from the "
+               "ComponentList at index " + std::to_string(i) + ".");
+        ++i;
+    }
+    ASSERT(i == cached.size(), __FILE__, __LINE__,
+           "Cached " + T::getClassName() + " list has extra components.");
+}
+
+void compareAllLists(const Model& model) {
+    compareWithComponentList(model, model.getCachedForces());
+    compareWithComponentList(model, model.getCachedActuators());
+    compareWithComponentList(model, model.getCachedMuscles());
+    compareWithComponentList(model, model.getCachedControllers());
+    compareWithComponentList(model, model.getCachedCoordinates());
+    compareWithComponentList(model, model.getCachedProbes());
+}
+
+void testCachedComponentLists()
+{
+    Model model("arm26.osim");
+
+    // The lists are built when connections are finalized.
+    ASSERT_THROW(Exception, model.getCachedForces());
+    model.initSystem();
+    compareAllLists(model);
+    ASSERT(model.getCachedMuscles().size() == 6);
+    ASSERT(model.getCachedCoordinates().size() == 2);
+
+    // Adding a component clears the lists until they are rebuilt.
+    model.addForce(new PrescribedForce("prescribed",
+            model.getComponent<Body>("./bodyset/r_ulna_radius_hand")));
+    ASSERT_THROW(Exception, model.getCachedForces());
+    model.initSystem();
+    compareAllLists(model);
+    ASSERT(model.getCachedForces().back()->getName() == "prescribed");
+
+    // A copy has its own lists, which point into the copy.
+    Model copy(model);
+    ASSERT_THROW(Exception, copy.getCachedForces());
+    copy.initSystem();
+    compareAllLists(copy);
+    ASSERT(copy.getCachedForces()[0] != model.getCachedForces()[0]);
+}
+
+void testModelTemplate()
+{
+    // A model with constraints, so that the instances start from an
+    // assembled state that they do not assemble themselves.
+    const std::string modelFile = "PushUpToesOnGroundExactConstraints.osim";
+    Model model(modelFile);
+    const SimTK::State& expected = model.initSystem();
+
+    ModelTemplate modelTemplate(modelFile);
+    SimTK_TEST_EQ(modelTemplate.getInitialState().getQ(), expected.getQ());
+
+    auto instances = modelTemplate.createInstances(4, 2);
+    ASSERT(instances.size() == 4);
+    for (const auto& instance : instances) {
+        ASSERT(instance->isValidSystem());
+        const SimTK::State& s = instance->getWorkingState();
+        SimTK_TEST_EQ(s.getQ(), expected.getQ());
+        SimTK_TEST_EQ(s.getU(), expected.getU());
+        SimTK_TEST_EQ(s.getZ(), expected.getZ());
+        ASSERT(s.getSystemStage() >= SimTK::Stage::Velocity);
+        // The instance computes the same as the model it was copied from.
+        instance->getMultibodySystem().realize(s, SimTK::Stage::Acceleration);
+        model.getMultibodySystem().realize(expected,
+                SimTK::Stage::Acceleration);
+        SimTK_TEST_EQ(s.getUDot(), expected.getUDot());
+    }
+
+    // The instances are independent of each other and of the template.
+    const std::string coordName =
+            instances[0]->getCoordinateSet()[0].getName();
+    instances[0]->updCoordinateSet()[0].setDefaultValue(0.123);
+    ASSERT(instances[1]->getCoordinateSet().get(coordName)
+            .getDefaultValue() != 0.123);
+    ASSERT(modelTemplate.getModel().getCoordinateSet().get(coordName)
+            .getDefaultValue() != 0.123);
+    ASSERT(&instances[0]->getMultibodySystem() !=
+           &instances[1]->getMultibodySystem());
+
+    // The initial state must come from a model with the same state variables.
+    Model arm("arm26.osim");
+    ASSERT_THROW(Exception, arm.initSystem(modelTemplate.getInitialState()));
+}
+
+// At a state realized to Acceleration, the residual of the model's own
+// derivatives and multipliers vanishes.
+void checkImplicitResidualAtSolution(const Model& model,
+                                     const SimTK::State& s) {
+    model.realizeAcceleration(s);
+    const SimTK::Vector residual =
+            model.calcImplicitResidual(s, s.getYDot(), s.getMultipliers());
+    ASSERT(residual.size() == model.getNumImplicitResiduals(s));
+    ASSERT(residual.size() == s.getNY() + s.getNQErr() + s.getNUErr());
+    const int nyDynamics = s.getNY();
+    SimTK_TEST_EQ_TOL(residual(0, nyDynamics),
+            SimTK::Vector(nyDynamics, 0.0), 1e-6);
+    // The constraint errors are those of the state.
+    SimTK_TEST_EQ(residual(nyDynamics, s.getNQErr()), s.getQErr());
+}
+
+void testImplicitResidual()
+{
+    // Thelen muscles have no implicit form; the residuals of their states
+    // come from their explicit derivatives. The model also has constraints.
+    {
+        Model model("PushUpToesOnGroundWithMuscles.osim");
+        SimTK::State& s = model.initSystem();
+        ASSERT(s.getNMultipliers() > 0 && s.getNZ() > 0);
+        checkImplicitResidualAtSolution(model, s);
+
+        // Wrong accelerations leave a multibody residual, and wrong
+        // multipliers leave a residual that is G^T dlambda.
+        SimTK::Vector yDot = s.getYDot();
+        yDot[s.getNQ()] += 1.0;
+        SimTK::Vector residual =
+                model.calcImplicitResidual(s, yDot, s.getMultipliers());
+        ASSERT(residual(s.getNQ(), s.getNU()).normInf() > 1e-3);
+        SimTK::Vector lambda = s.getMultipliers();
+        lambda[0] += 1.0;
+        residual = model.calcImplicitResidual(s, s.getYDot(), lambda);
+        ASSERT(residual(s.getNQ(), s.getNU()).normInf() > 1e-3);
+        ASSERT(residual(0, s.getNQ()).normInf() < 1e-10);
+    }
+
+    // A Millard muscle with a compliant tendon uses the equilibrium of the
+    // fiber and tendon forces as the residual of its fiber length.
+    Model model("arm26.osim");
+    auto* muscle = new Millard2012EquilibriumMuscle("millard",
+            500.0, 0.12, 0.2, 0.0);
+    muscle->addNewPathPoint("origin",
+            model.updComponent<Body>("./bodyset/r_humerus"),
+            SimTK::Vec3(0, -0.05, 0.01));
+    muscle->addNewPathPoint("insertion",
+            model.updComponent<Body>("./bodyset/r_ulna_radius_hand"),
+            SimTK::Vec3(0, -0.05, 0.01));
+    model.addForce(muscle);
+    SimTK::State& s = model.initSystem();
+    ASSERT(muscle->hasImplicitForm("fiber_length"));
+    ASSERT(!muscle->hasImplicitForm("activation"));
+    model.getCoordinateSet().get("r_elbow_flex").setSpeedValue(s, 1.0);
+    muscle->setActivation(s, 0.3);
+    checkImplicitResidualAtSolution(model, s);
+
+    // Residuals of many states, in parallel, match the serial ones, also
+    // for states whose discrete variables differ from the default ones.
+    const auto& biceps = model.getMuscles().get("BIClong");
+    const auto& triceps = model.getMuscles().get("TRIlong");
+    std::vector<SimTK::State> states;
+    std::vector<SimTK::Vector> yDots;
+    for (int i = 0; i < 6; ++i) {
+        states.push_back(s);
+        SimTK::State& state = states.back();
+        state.setTime(0.1 * i);
+        state.updQ()[1] += 0.1 * i;
+        if (i % 3 == 1) {
+            biceps.overrideActuation(state, true);
+            biceps.setOverrideActuation(state, 50.0 * i);
+        }
+        if (i % 3 == 2) triceps.setAppliesForce(state, false);
+        model.realizeAcceleration(state);
+        yDots.push_back(state.getYDot() + 0.01 * i);
+    }
+    SimTK::State defaults = states[5];
+    triceps.setAppliesForce(defaults, true);
+    ASSERT(model.calcImplicitResidual(defaults, yDots[5])(
+            defaults.getNQ(), defaults.getNU()).normInf() > 1e-6);
+    const auto serial = model.calcImplicitResiduals(states, yDots);
+    const auto parallel = model.calcImplicitResiduals(states, yDots, {}, 3);
+    ASSERT(serial.size() == states.size() && parallel.size() == states.size());
+    for (size_t i = 0; i < states.size(); ++i) {
+        SimTK_TEST_EQ(serial[i],
+                model.calcImplicitResidual(states[i], yDots[i]));
+        SimTK_TEST_EQ(parallel[i], serial[i]);
+    }
+    ASSERT_THROW(Exception, model.calcImplicitResiduals(states, {}));
+
+    // The residual of the fiber length depends on its derivative, and the
+    // kinematic residuals only on q, u and qdot.
+    const auto nonzeros =
+            model.calcImplicitResidualSparsity(s, s.getYDot());
+    const int nq = s.getNQ(), nu = s.getNU(), ny = s.getNY();
+    SimTK::State moved = s;
+    muscle->setFiberLength(moved, muscle->getFiberLength(s) + 0.01);
+    int fiberLengthRow = -1;
+    for (int i = 0; i < s.getNZ(); ++i)
+        if (moved.getZ()[i] != s.getZ()[i]) fiberLengthRow = nq + nu + i;
+    ASSERT(fiberLengthRow >= nq + nu);
+    bool fiberDependsOnItsDerivative = false;
+    for (const auto& nz : nonzeros) {
+        if (nz.first == fiberLengthRow && nz.second == ny + fiberLengthRow)
+            fiberDependsOnItsDerivative = true;
+        if (nz.first < nq)
+            ASSERT(nz.second < nq + nu || (nz.second >= ny &&
+                                           nz.second < ny + nq));
+    }
+    ASSERT(fiberDependsOnItsDerivative);
+}
+
+void testReadSetsConcurrently()
+{
+    // The file is of an older version, so its sets are read one at a time.
+    // Printed again, it is of the latest version, whose sets are read
+    // concurrently, and must be read as the same model.
+    Model model("gait2354_simbody.osim");
+    model.print("testReadSetsConcurrently.osim");
+
+    Model reloaded("testReadSetsConcurrently.osim");
+    ASSERT(reloaded == model);
+    ASSERT(reloaded.getBodySet().getSize() == model.getBodySet().getSize());
+    ASSERT(reloaded.getForceSet().getSize() == model.getForceSet().getSize());
+    ASSERT(reloaded.getMarkerSet().getSize() ==
+           model.getMarkerSet().getSize());
+    reloaded.initSystem();
+}
+
+void testModelCache()
+{
+    // A model file of an older version, which the cache keeps updated.
+    const std::string modelFile = "testModelCache.osim";
+    {
+        std::ifstream in("gait2354_simbody.osim");
+        std::ofstream out(modelFile);
+        out << in.rdbuf();
+    }
+    const Model expected(modelFile);
+
+    ModelCache cache("testModelCache");
+    std::unique_ptr<Model> model = cache.load(modelFile);
+    const ModelCache::LoadStats first = cache.getLastLoadStats();
+    ASSERT(!first.cacheHit && first.cacheWritten);
+    ASSERT(*model == expected);
+
+    model = cache.load(modelFile);
+    ASSERT(cache.getLastLoadStats().cacheHit);
+    ASSERT(cache.getLastLoadStats().cacheFile == first.cacheFile);
+    ASSERT(*model == expected);
+    ASSERT(model->getInputFileName() == expected.getInputFileName());
+    model->initSystem();
+
+    // A copy that cannot be read is written again.
+    std::ofstream(first.cacheFile) << "<OpenSimDocument";
+    model = cache.load(modelFile);
+    ASSERT(!cache.getLastLoadStats().cacheHit);
+    ASSERT(cache.getLastLoadStats().cacheWritten);
+    ASSERT(*model == expected);
+    cache.load(modelFile);
+    ASSERT(cache.getLastLoadStats().cacheHit);
+
+    // Editing the model file changes the copy it is read from. Text that
+    // only looks like a file attribute does not keep the file from being
+    // cached.
+    std::ofstream(modelFile, std::ios::app) << "<!-- file=\"edited\" -->"
+                                            << std::endl;
+    cache.load(modelFile);
+    ASSERT(!cache.getLastLoadStats().cacheHit);
+    ASSERT(cache.getLastLoadStats().cacheWritten);
+    ASSERT(cache.getLastLoadStats().cacheFile != first.cacheFile);
+
+    // A model file in the latest file format is not cached.
+    cache.load(first.cacheFile);
+    ASSERT(cache.getLastLoadStats().cacheFile.empty());
+    ASSERT(!cache.getLastLoadStats().cacheWritten);
+    ASSERT(!cache.getLastLoadStats().skipReason.empty());
+
+    ASSERT_THROW(FileDoesNotExist, cache.load("notAModelFile.osim"));
+
+    // A Model read from its copy finds its meshes next to the model file,
+    // not in the cache directory. The model file and its only mesh are put
+    // in a directory of their own, so that the mesh is not found in the
+    // working directory either.
+    const std::string meshDirectory = "testModelCacheMesh";
+    const std::string meshModelFile = meshDirectory + "/model.osim";
+    IO::makeDir(meshDirectory);
+    {
+        std::ifstream in("gait2354_simbody.osim");
+        std::stringstream contents;
+        contents << in.rdbuf();
+        std::string text = contents.str();
+        const std::string pelvis = "sacrum.vtp pelvis.vtp l_pelvis.vtp";
+        text.replace(text.find(pelvis), pelvis.size(), "testModelCache.obj");
+        std::ofstream(meshModelFile) << text;
+        std::ifstream mesh("sphere.obj");
+        std::ofstream(meshDirectory + "/testModelCache.obj") << mesh.rdbuf();
+    }
+    auto countMeshDecorations = [](Model& meshModel) {
+        SimTK::State& s = meshModel.initSystem();
+        meshModel.realizePosition(s);
+        SimTK::Array_<SimTK::DecorativeGeometry> decorations;
+        for (const Mesh& mesh : meshModel.getComponentList<Mesh>()) {
+            if (mesh.get_mesh_file() == "testModelCache.obj")
+                mesh.generateDecorations(true, meshModel.getDisplayHints(),
+                                         s, decorations);
+        }
+        return (int)decorations.size();
+    };
+    model = cache.load(meshModelFile);
+    ASSERT(cache.getLastLoadStats().cacheWritten);
+    ASSERT(countMeshDecorations(*model) == 1);
+    model = cache.load(meshModelFile);
+    ASSERT(cache.getLastLoadStats().cacheHit);
+    ASSERT(countMeshDecorations(*model) == 1);
+}
@@ -55,6 +55,7 @@ void testMomentArmDefinitionForModel(const string &filename,
                                      double mass = -1.0, string errorMessage = "");
 
 void testMomentArmsAcrossCompoundJoint();
+void testMomentArmSolverReuse();
 
 int main()
 {
@@ -67,6 +68,9 @@ int main()
         testMomentArmsAcrossCompoundJoint();
         cout << "Joint composed of more than one mobilized body: PASSED\n" << endl;
 
+        testMomentArmSolverReuse();
+        cout << "Reusing coupling vectors of a MomentArmSolver: PASSED\n" << endl;
+
         testMomentArmDefinitionForModel("BothLegs22.osim", "r_knee_angle", "VASINT", 
             SimTK::Vec2(-2*SimTK::Pi/3, SimTK::Pi/18), 0.0, 
             "VASINT of BothLegs with no mass: FAILED");
@@ -166,6 +170,33 @@ void testMomentArmsAcrossCompoundJoint()
         0.0, "testMomentArmsAcrossCompoundJoint: FAILED");
 }
 
+// A solver reused across muscles, coordinates and states, which reuses its
+// coupling vectors while the coordinate values do not change, must agree with
+// a new solver for each moment arm.
+void testMomentArmSolverReuse()
+{
+    Model model("testMomentArmsConstraintB.osim");
+    SimTK::State& s = model.initSystem();
+
+    MomentArmSolver maSolver(model);
+    const Coordinate& hip = model.getCoordinateSet().get("hip_flexion_r");
+    const Coordinate& knee = model.getCoordinateSet().get("knee_angle_r");
+
+    for (double angle : {-1.5, -0.5, 0.1}) {
+        knee.setValue(s, angle, true);
+        for (int i = 0; i < model.getMuscles().getSize(); ++i) {
+            const GeometryPath& path =
+                model.getMuscles()[i].getGeometryPath();
+            for (const Coordinate* coord : {&hip, &knee, &knee, &hip}) {
+                const double expected =
+                    MomentArmSolver(model).solve(s, *coord, path);
+                ASSERT_EQUAL(expected, maSolver.solve(s, *coord, path),
+                             1e-12);
+            }
+        }
+    }
+}
+
 //==========================================================================================================
 // moment_arm = dl/dtheta, definition using inexact perturbation technique
 //==========================================================================================================
@@ -98,6 +98,8 @@ void simulateMuscle(const Muscle &aMuscle,
                     double testTolerance,
                     bool printResults);
 
+void testProbeInputsComputedOnce();
+
 
 int main()
 {
@@ -139,6 +141,12 @@ int main()
         failures.push_back("testProbes");
     }
 
+    try { testProbeInputsComputedOnce(); }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testProbeInputsComputedOnce");
+    }
+
 
     printf("\n\n");
     cout << "************************************************************" << endl;
@@ -617,3 +625,58 @@ void simulateMuscle(
 
 
 }
+
+// A probe with several inputs that counts how often they are computed.
+class CountingProbe : public Probe {
+    OpenSim_DECLARE_CONCRETE_OBJECT(CountingProbe, Probe);
+public:
+    CountingProbe() = default;
+    Array<string> getProbeOutputLabels() const override {
+        Array<string> labels;
+        for (int i = 0; i < getNumProbeInputs(); ++i)
+            labels.append("input" + std::to_string(i));
+        return labels;
+    }
+    SimTK::Vector computeProbeInputs(const SimTK::State& s) const override {
+        ++numEvaluations;
+        SimTK::Vector inputs(getNumProbeInputs());
+        for (int i = 0; i < inputs.size(); ++i)
+            inputs[i] = (i + 1) * s.getTime();
+        return inputs;
+    }
+    int getNumProbeInputs() const override { return 5; }
+    mutable int numEvaluations = 0;
+};
+
+void testProbeInputsComputedOnce()
+{
+    // All the inputs of a probe must be computed once per realization, not
+    // once per input.
+    Model model;
+    auto* body = new Body("body", 1.0, SimTK::Vec3(0), SimTK::Inertia(1));
+    model.addBody(body);
+    model.addJoint(new PinJoint("pin", model.getGround(), *body));
+    auto* probe = new CountingProbe();
+    probe->setName("counter");
+    probe->setOperation("integrate");
+    probe->setInitialConditions(SimTK::Vector(5, 0.0));
+    model.addProbe(probe);
+    SimTK::State& s = model.initSystem();
+
+    s.setTime(0.5);
+    model.realizeAcceleration(s);
+    probe->numEvaluations = 0;
+    probe->getProbeOutputs(s);
+    ASSERT(probe->numEvaluations == 1, __FILE__, __LINE__,
+           "Probe inputs were computed more than once per realization.");
+
+    // The integrals of the inputs i*t are i*t^2/2.
+    s.setTime(0);
+    Manager manager(model);
+    manager.initialize(s);
+    const SimTK::State& finalState = manager.integrate(1.0);
+    model.realizeAcceleration(finalState);
+    const SimTK::Vector outputs = probe->getProbeOutputs(finalState);
+    for (int i = 0; i < outputs.size(); ++i)
+        ASSERT_EQUAL(0.5 * (i + 1), outputs[i], 1e-6);
+}
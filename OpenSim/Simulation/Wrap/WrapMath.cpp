@@ -30,6 +30,8 @@
 //=============================================================================
 #include <math.h>
 #include "WrapMath.h"
+#include <algorithm>
+#include <utility>
 #include <OpenSim/Common/Mtx.h>
 #include <OpenSim/Common/SimmMacros.h>
 
@@ -45,7 +47,68 @@ using SimTK::Mat33;
 
 #define LINE_EPSILON 0.00001
 
+//=============================================================================
+// POLYNOMIAL ROOTS
+//=============================================================================
+namespace {
+// Value and derivative of c[0] + c[1] x + ... + c[degree] x^degree.
+double evalPolynomial(const double c[], int degree, double x, double* slope)
+{
+    double p = c[degree], dp = 0;
+    for (int i = degree - 1; i >= 0; --i) {
+        dp = dp * x + p;
+        p = p * x + c[i];
+    }
+    if (slope) *slope = dp;
+    return p;
+}
 
+// Find the root of a polynomial in each interval [ends[k], ends[k+1]] at
+// whose ends it has opposite signs, with Newton steps safeguarded by
+// bisection. The polynomial must be monotonic in each interval.
+int findBracketedRoots(const double c[], int degree, const double ends[],
+                       int numEnds, double roots[])
+{
+    int numRoots = 0;
+    for (int k = 0; k + 1 < numEnds; ++k) {
+        double lo = ends[k], hi = ends[k + 1];
+        const double plo = evalPolynomial(c, degree, lo, nullptr);
+        const double phi = evalPolynomial(c, degree, hi, nullptr);
+        if (plo == 0 || phi == 0 || (plo < 0) == (phi < 0)) continue;
+        double x = 0.5 * (lo + hi);
+        for (int i = 0; i < 60; ++i) {
+            double slope;
+            const double p = evalPolynomial(c, degree, x, &slope);
+            if ((p < 0) == (plo < 0)) lo = x; else hi = x;
+            double next = slope != 0 ? x - p / slope : lo;
+            if (next <= lo || next >= hi) next = 0.5 * (lo + hi);
+            const bool converged =
+                    std::abs(next - x) <= 1e-15 * (1 + std::abs(x));
+            x = next;
+            if (converged) break;
+        }
+        roots[numRoots++] = x;
+    }
+    return numRoots;
+}
+
+// Find the real roots in [lo, hi] of c[0] + c[1] x + ... + c[degree] x^degree
+// that are not roots of its derivative, in increasing order. The roots of
+// the derivative split [lo, hi] into intervals in which the polynomial is
+// monotonic. The degree is at most 4.
+int findRealRoots(const double c[], int degree, double lo, double hi,
+                  double roots[])
+{
+    if (degree < 1) return 0;
+    double derivative[4], ends[6];
+    for (int i = 1; i <= degree; ++i) derivative[i - 1] = i * c[i];
+    int numEnds = 0;
+    ends[numEnds++] = lo;
+    numEnds += findRealRoots(derivative, degree - 1, lo, hi, ends + 1);
+    ends[numEnds++] = hi;
+    return findBracketedRoots(c, degree, ends, numEnds, roots);
+}
+} // anonymous namespace
 
 //=============================================================================
 // GEOMETRY
@@ -291,6 +354,116 @@ CalcDistanceSquaredPointToLine(SimTK::Vec3& point, SimTK::Vec3& linePt, SimTK::V
 
     return CalcDistanceSquaredBetweenPoints(point, ptemp);
 }
+/* Find the points of a line that are closest to an origin-centered circle in
+ * the Z=0 plane, i.e., the local minima of the distance between the line and
+ * the circle. They are found from the real roots of a quartic, so the result
+ * does not depend on an initial guess and is exact to round-off.
+ * @param radius the radius of the circle
+ * @param linePt a point on the line
+ * @param line the unit direction of the line
+ * @param t the closest points, as distances along the line from linePt,
+ *          nearest to the circle first
+ * @return the number of closest points (1 or 2)
+ */
+int WrapMath::
+CalcClosestPointsOnLineToCircle(double radius, const SimTK::Vec3& linePt,
+                                const SimTK::Vec3& line, double t[2])
+{
+    // Measure the line from its point closest to the origin, x0, in units of
+    // the radius: x(w) = x0 + w*radius*line.
+    const double k = linePt[0]*line[0] + linePt[1]*line[1] + linePt[2]*line[2];
+    const double x0[3] = { linePt[0] - k*line[0], linePt[1] - k*line[1],
+                           linePt[2] - k*line[2] };
+    const double a = line[0]*line[0] + line[1]*line[1];
+    if (a <= SimTK::Eps) {
+        // The line is parallel to the axis of the circle.
+        t[0] = -k;
+        return 1;
+    }
+    const double r2 = radius*radius;
+    const double m = (x0[0]*line[0] + x0[1]*line[1]) / radius;
+    const double e = (x0[0]*x0[0] + x0[1]*x0[1]) / r2;
+    const double h = e + x0[2]*x0[2] / r2;
+
+    // With rho(w)^2 = a*w^2 + 2*m*w + e the squared distance of x(w) from
+    // the axis of the circle, the squared distance to the circle is
+    // w^2 + h + 1 - 2*rho(w) and its stationary points satisfy
+    // w*rho(w) = a*w + m. Squaring gives a quartic whose real roots all lie
+    // in [-sqrt(a), sqrt(a)]. Its multiple roots are roots of its derivative.
+    const double quartic[5] = { -m*m, -2*a*m, e - a*a, 2*m, a };
+    const double cubic[4] = { -2*a*m, 2*(e - a*a), 6*m, 4*a };
+    const double bound = 1.001;
+    double ends[5], candidates[7];
+    int numEnds = 0;
+    ends[numEnds++] = -bound;
+    numEnds += findRealRoots(cubic, 3, -bound, bound, ends + 1);
+    ends[numEnds++] = bound;
+    int numCandidates =
+            findBracketedRoots(quartic, 4, ends, numEnds, candidates);
+    for (int i = 1; i + 1 < numEnds; ++i)
+        if (std::abs(evalPolynomial(quartic, 4, ends[i], nullptr)) <= 1e-12)
+            candidates[numCandidates++] = ends[i];
+
+    // Keep the minima of the distance, rather than its maxima and the roots
+    // introduced by squaring (w*rho = -(a*w + m)), nearest first.
+    std::pair<double, double> minima[7];
+    int numMinima = 0;
+    for (int i = 0; i < numCandidates; ++i) {
+        const double w = candidates[i];
+        const double rho2 = std::max(a*w*w + 2*m*w + e, 0.0);
+        const double rho = std::sqrt(rho2);
+        const double s = a*w + m;
+        if (std::abs(w*rho - s) > std::abs(w*rho + s) + 1e-12 ||
+                rho2*rho < a*rho2 - s*s)
+            continue;
+        minima[numMinima++] = std::make_pair(w*w + h + 1 - 2*rho, w);
+    }
+    std::sort(minima, minima + numMinima);
+    numMinima = std::min(numMinima, 2);
+    for (int i = 0; i < numMinima; ++i)
+        t[i] = minima[i].second*radius - k;
+    return numMinima;
+}
+
+/* Refine an estimate of a point of a line that is closest to an
+ * origin-centered circle in the Z=0 plane, with at most maxIterations Newton
+ * steps. This is much cheaper than CalcClosestPointsOnLineToCircle() when
+ * the estimate is good, e.g., the closest point of the previous time step,
+ * but it finds the local minimum of the distance near the estimate, which
+ * need not be the global one.
+ * @param radius the radius of the circle
+ * @param linePt a point on the line
+ * @param line the unit direction of the line
+ * @param t the estimate on input and the closest point on output, as
+ *          distances along the line from linePt
+ * @param maxIterations the maximum number of Newton steps
+ * @return true if the steps converged to a minimum of the distance
+ */
+bool WrapMath::
+RefineClosestPointOnLineToCircle(double radius, const SimTK::Vec3& linePt,
+                                 const SimTK::Vec3& line, double& t,
+                                 int maxIterations)
+{
+    const double a = line[0]*line[0] + line[1]*line[1];
+    for (int i = 0; i < maxIterations; ++i) {
+        const double x[3] = { linePt[0] + t*line[0], linePt[1] + t*line[1],
+                              linePt[2] + t*line[2] };
+        const double rho2 = x[0]*x[0] + x[1]*x[1];
+        if (rho2 <= SimTK::Eps*radius*radius) return false;
+        const double rho = std::sqrt(rho2);
+        const double s = x[0]*line[0] + x[1]*line[1];
+        // First and second derivatives of half the squared distance.
+        const double g = x[0]*line[0] + x[1]*line[1] + x[2]*line[2]
+                         - radius*s/rho;
+        const double dg = 1 - radius*(a*rho2 - s*s)/(rho2*rho);
+        if (dg <= 0) return false;
+        const double step = std::max(-radius, std::min(radius, -g/dg));
+        t += step;
+        if (std::abs(step) <= 1e-12*radius) return true;
+    }
+    return false;
+}
+
 /* Rotate a 4x4 transform matrix by 'angle' radians about axis 'axis'.
  * @param matrix The 4x4 transform matrix
  * @param axis The axis about which to rotate
@@ -67,6 +67,12 @@ public:
         CalcDistanceSquaredBetweenPoints(SimTK::Vec3& point1, SimTK::Vec3& point2);
     static double
         CalcDistanceSquaredPointToLine(SimTK::Vec3& point, SimTK::Vec3& linePt, SimTK::Vec3& line);
+    static int
+        CalcClosestPointsOnLineToCircle(double radius, const SimTK::Vec3& linePt,
+        const SimTK::Vec3& line, double t[2]);
+    static bool
+        RefineClosestPointOnLineToCircle(double radius, const SimTK::Vec3& linePt,
+        const SimTK::Vec3& line, double& t, int maxIterations);
     static void
         RotateMatrixAxisAngle(double matrix[][4], const SimTK::Vec3& axis, double angle);
     static void
@@ -26,10 +26,10 @@
 //=============================================================================
 #include "WrapTorus.h"
 #include "WrapCylinder.h"
+#include "WrapMath.h"
 #include "WrapResult.h"
 #include <OpenSim/Common/ModelDisplayHints.h>
 #include <OpenSim/Common/SimmMacros.h>
-#include <OpenSim/Common/Lmdif.h>
 #include <OpenSim/Common/Mtx.h>
 #include <OpenSim/Simulation/Model/PhysicalFrame.h>
 #include <OpenSim/Common/ScaleSet.h>
@@ -211,7 +211,22 @@ int WrapTorus::wrapLine(const SimTK::State& s, SimTK::Vec3& aPoint1, SimTK::Vec3
     //bool far_side_wrap = false;
     aFlag = true;
 
-    if (findClosestPoint(get_outer_radius(), &aPoint1[0], &aPoint2[0], &closestPt[0], &closestPt[1], &closestPt[2], _wrapSign, _wrapAxis) == 0)
+    // Start from the previous wrap of this segment, if any. Its tangent
+    // points lie on the tube around the closest point on the circle.
+    const WrapResult& previousWrap = aPathWrap.getPreviousWrap();
+    SimTK::Vec3 estimate;
+    const bool hasEstimate = previousWrap.startPoint >= 0 &&
+            previousWrap.startPoint == aWrapResult.startPoint &&
+            previousWrap.endPoint == aWrapResult.endPoint &&
+            previousWrap.wrap_pts.getSize() > 0;
+    if (hasEstimate) {
+        estimate = _pose.shiftBaseStationToFrame(
+                0.5 * (previousWrap.r1 + previousWrap.r2));
+    }
+
+    if (findClosestPoint(get_outer_radius(), aPoint1, aPoint2,
+                         hasEstimate ? &estimate : nullptr, closestPt,
+                         _wrapSign, _wrapAxis) == 0)
         return noWrap;
 
     // Now put a cylinder at closestPt and call the cylinder wrap code.
@@ -258,200 +273,69 @@ int WrapTorus::wrapLine(const SimTK::State& s, SimTK::Vec3& aPoint1, SimTK::Vec3
  * to the line between p1 and p2. This circle represents the inner axis of
  * the torus.
  *
+ * If an estimate is given (the closest point found for the previous wrap of
+ * the same path segment), a few Newton steps from it usually suffice, which
+ * also keeps the wrap on the same side of the torus from one call to the
+ * next. Otherwise, or if the steps do not converge, the closest points are
+ * computed from the roots of a quartic (WrapMath).
+ *
  * @param radius The radius of the circle
  * @param p1 One end of the line
  * @param p2 The other end of the line
- * @param xc The X coordinate of the closest point
- * @param yc The Y coordinate of the closest point
- * @param zc The Z coordinate of the closest point
+ * @param estimate An estimate of the closest point on the circle, or null
+ * @param closestPt The closest point on the circle
  * @param wrap_sign If wrap is constrained to a quadrant, the sign of the relevant axis
  * @param wrap_axis If wrap is constrained to a quadrant, the relevant axis
  * @return '1' if a closest point was found, '0' if there was an error while trying to constrain the wrap
  */
-int WrapTorus::findClosestPoint(double radius, double p1[], double p2[],
-                                          double* xc, double* yc, double* zc,
-                                          int wrap_sign, int wrap_axis) const
+int WrapTorus::findClosestPoint(double radius, const Vec3& p1, const Vec3& p2,
+                                const Vec3* estimate, Vec3& closestPt,
+                                int wrap_sign, int wrap_axis) const
 {
-   int info;                  // output flag
-   int num_func_calls;        // number of calls to func (nfev)
-   int ldfjac = 1;            // leading dimension of fjac (nres)
-   int numResid = 1;
-   int numQs = 1;
-   double q[2], resid[2], fjac[2];            // m X n array
-   CircleCallback cb;
+   const int maxNewtonSteps = 4;
    bool constrained = (bool) (wrap_sign != 0);
-   // solution parameters
-   int mode = 1, nprint = 0, max_iter = 500;
-   double ftol = 1e-4, xtol = 1e-4, gtol = 0.0;
-   double epsfcn = 0.0, step_factor = 0.2;
-   // work arrays
-   int ipvt[2];
-   double diag[2], qtf[2], wa1[2], wa2[2], wa3[2], wa4[2];
-   // Circle variables
-   double u, mag, nx, ny, nz, x, y, z, a1[3], a2[3], distance1, distance2, betterPt = 0;
-
-   cb.p1[0] = p1[0];
-   cb.p1[1] = p1[1];
-   cb.p1[2] = p1[2];
-   cb.p2[0] = p2[0];
-   cb.p2[1] = p2[1];
-   cb.p2[2] = p2[2];
-   cb.r = radius;
-
-   q[0] = 0.0;
-
-   lmdif_C(calcCircleResids, numResid, numQs, q, resid,
-           ftol, xtol, gtol, max_iter, epsfcn, diag, mode, step_factor,
-           nprint, &info, &num_func_calls, fjac, ldfjac, ipvt, qtf,
-           wa1, wa2, wa3, wa4, (void*)&cb);
-
-   u = q[0];
-
-   mag = sqrt((p2[0]-p1[0])*(p2[0]-p1[0]) + (p2[1]-p1[1])*(p2[1]-p1[1]) + (p2[2]-p1[2])*(p2[2]-p1[2]));
-
-   nx = (p2[0]-p1[0]) / mag;
-   ny = (p2[1]-p1[1]) / mag;
-   nz = (p2[2]-p1[2]) / mag;
-
-   x = p1[0] + u * nx;
-   y = p1[1] + u * ny;
-   z = p1[2] + u * nz;
-
-   // Store the result from the first pass.
-   a1[0] = x;
-   a1[1] = y;
-   a1[2] = z;
-
-   distance1 = sqrt(x*x + y*y + z*z + radius*radius - 2.0 * radius * sqrt(x*x + y*y));
-
-   // Perform the second pass, switching the order of the two points.
-   cb.p1[0] = p2[0];
-   cb.p1[1] = p2[1];
-   cb.p1[2] = p2[2];
-   cb.p2[0] = p1[0];
-   cb.p2[1] = p1[1];
-   cb.p2[2] = p1[2];
-   cb.r = radius;
-
-   q[0] = 0.0;
-
-   lmdif_C(calcCircleResids, numResid, numQs, q, resid,
-           ftol, xtol, gtol, max_iter, epsfcn, diag, mode, step_factor,
-           nprint, &info, &num_func_calls, fjac, ldfjac, ipvt, qtf,
-           wa1, wa2, wa3, wa4, (void*)&cb);
-
-   u = q[0];
-
-   mag = sqrt((p2[0]-p1[0])*(p2[0]-p1[0]) + (p2[1]-p1[1])*(p2[1]-p1[1]) + (p2[2]-p1[2])*(p2[2]-p1[2]));
-
-   nx = (p1[0]-p2[0]) / mag;
-   ny = (p1[1]-p2[1]) / mag;
-   nz = (p1[2]-p2[2]) / mag;
-
-   x = p2[0] + u * nx;
-   y = p2[1] + u * ny;
-   z = p2[2] + u * nz;
-
-   // Store the result from the second pass.
-   a2[0] = x;
-   a2[1] = y;
-   a2[2] = z;
-
-   distance2 = sqrt(x*x + y*y + z*z + radius*radius - 2.0 * radius * sqrt(x*x + y*y));
-
-   // Now choose the better result from the two passes. If the circle is not
-   // constrained, then just choose the one with the shortest distance. If the
-   // circle is constrained, then choose the one that is on the correct half of
-   // the circle. If both are on the correct half, choose the closest.
-   if (constrained)
-   {
-      if (DSIGN(a1[wrap_axis]) == wrap_sign && DSIGN(a2[wrap_axis]) == wrap_sign)
-      {
-         if (distance1 < distance2)
-            betterPt = 0;
-         else
-            betterPt = 1;
-      }
-      else if (DSIGN(a1[wrap_axis]) == wrap_sign)
-      {
-         betterPt = 0;
-      }
-      else if (DSIGN(a2[wrap_axis]) == wrap_sign)
-      {
-         betterPt = 1;
-      }
-      else
-      {
-         // no wrapping should occur
-         return 0;
-      }
-   }
-   else
-   {
-      if (distance1 < distance2)
-         betterPt = 0;
-      else
-         betterPt = 1;
+   Vec3 line = p2 - p1;
+   const double mag = line.norm();
+   if (mag == 0.0)
+      return 0;
+   line /= mag;
+
+   // The points on the line that are closest to the circle, as distances
+   // from p1, nearest first.
+   double t[2];
+   int numPts = 0;
+   if (estimate) {
+      t[0] = ~(*estimate - p1) * line;
+      if (WrapMath::RefineClosestPointOnLineToCircle(radius, p1, line, t[0],
+                                                     maxNewtonSteps))
+         numPts = 1;
    }
+   if (numPts == 0 ||
+       (constrained && DSIGN((p1 + t[0] * line)[wrap_axis]) != wrap_sign))
+      numPts = WrapMath::CalcClosestPointsOnLineToCircle(radius, p1, line, t);
 
-   // a1 and a2 represent the points on the line that are closest to the circle.
-   // What you need to find and return is the corresponding point on the circle.
-   if (betterPt == 0)
-   {
-      mag = (sqrt(a1[0]*a1[0] + a1[1]*a1[1]));
-      *xc = a1[0] * radius / mag;
-      *yc = a1[1] * radius / mag;
-      *zc = 0.0;
-   }
-   else
+   // If the circle is constrained, choose the nearest point that is on the
+   // correct half of the circle.
+   for (int i = 0; i < numPts; i++)
    {
-      mag = (sqrt(a2[0]*a2[0] + a2[1]*a2[1]));
-      *xc = a2[0] * radius / mag;
-      *yc = a2[1] * radius / mag;
-      *zc = 0.0;
+      const Vec3 a = p1 + t[i] * line;
+      if (constrained && DSIGN(a[wrap_axis]) != wrap_sign)
+         continue;
+
+      // a is the point on the line that is closest to the circle. What you
+      // need to return is the corresponding point on the circle.
+      const double magXY = sqrt(a[0]*a[0] + a[1]*a[1]);
+      if (magXY > 0.0)
+         closestPt = Vec3(a[0] * radius / magXY, a[1] * radius / magXY, 0.0);
+      else
+         closestPt = Vec3(radius, 0.0, 0.0);
+      return 1;
    }
 
-   return 1;
-}
-
-//_____________________________________________________________________________
-/**
- * A utility function used by findClosestPoint. The single residual that it
- * calculates is the distance between the current point and the circle.
- *
- * @param numResid The number of residuals (1)
- * @param numQs The number of degrees of freedom (1)
- * @param q Array of values of the degrees of freedom
- * @param resid Array of residuals to be calculated
- * @param flag2 A status flag
- * @param ptr Pointer to data structure containing current point and circle radius
- */
-void WrapTorus::calcCircleResids(int numResid, int numQs, double q[],
-                                            double resid[], int *flag2, void *ptr)
-{
-   double mag, nx, ny, nz, u;
-   double c2, c3, c4, c5/*, c6*/;
-   CircleCallback *cb = (CircleCallback*)ptr;
-
-   u = q[0];
-
-   mag = sqrt((cb->p2[0]-cb->p1[0])*(cb->p2[0]-cb->p1[0]) + (cb->p2[1]-cb->p1[1])*(cb->p2[1]-cb->p1[1]) +
-      (cb->p2[2]-cb->p1[2])*(cb->p2[2]-cb->p1[2]));
-
-   nx = (cb->p2[0]-cb->p1[0]) / mag;
-   ny = (cb->p2[1]-cb->p1[1]) / mag;
-   nz = (cb->p2[2]-cb->p1[2]) / mag;
-
-   c2 = 2.0 * (cb->p1[0]*nx + cb->p1[1]*ny + cb->p1[2]*nz);
-   c3 = cb->p1[0]*nx + cb->p1[1]*ny;
-   c4 = nx*nx + ny*ny;
-   c5 = cb->p1[0]*cb->p1[0] + cb->p1[1]*cb->p1[1];
-   //c6 = sqrt (u * u * c4 + 2.0 * c3 * u + c5);
-
-   resid[0] = c2 + 2.0 * u - 2.0 * cb->r * (2.0 * c4 * u + 2.0 * c3) / sqrt (u * u * c4 + 2.0 * c3 * u + c5);
+   // no wrapping should occur
+   return 0;
 }
 
-
 // Implement generateDecorations by WrapTorus to replace the previous out of place implementation
 // in ModelVisualizer, not implemented yet in API visualizer
 void WrapTorus::generateDecorations(bool fixed, const ModelDisplayHints& hints, const SimTK::State& state,
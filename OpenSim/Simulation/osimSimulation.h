@@ -27,6 +27,8 @@
 #include "Model/Bhargava2004MuscleMetabolicsProbe.h"
 #include "Model/Model.h"
 #include "Model/ModelVisualizer.h"
+#include "Model/ModelTemplate.h"
+#include "Model/ModelCache.h"
 #include "Model/ForceSet.h"
 #include "Model/BodyScale.h"
 #include "Model/BodyScaleSet.h"
@@ -0,0 +1,590 @@
+/* -------------------------------------------------------------------------- *
+ *                       OpenSim:  osimBenchmarks.cpp                         *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2019 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+/*=============================================================================
+
+Throughput benchmarks for core OpenSim workloads:
+ - model_loading:        load and initialize models         (models/s)
+ - model_loading_cached: model_loading from the copies kept by a
+                         ModelCache                          (models/s)
+ - forward_arm26:        Manager::integrate() on arm26       (simulated s/s)
+ - forward_gait10dof:    Manager::integrate() on gait10dof   (simulated s/s)
+ - forward_metabolics_N: forward_gait10dof with a metabolics probe reporting
+                         N muscles separately                (simulated s/s)
+ - inverse_kinematics:   InverseKinematicsTool on gait10dof  (frames/s)
+ - inverse_dynamics:     InverseDynamicsTool on gait10dof    (frames/s)
+ - static_optimization:  StaticOptimization on gait2354      (frames/s)
+ - muscle_analysis:      MuscleAnalysis on gait2354          (frames/s)
+ - wrap_torus_*:         closest point of a line to the axis of a torus, as
+                         used by WrapTorus: from scratch (_quartic), from
+                         the previous solution (_warm) and with the former
+                         Levenberg-Marquardt solver (_lmdif)   (solves/s)
+ - read_sto, read_trc, read_c3d, read_c3d_native: file parsing (MB/s)
+
+Each benchmark is repeated and the best (highest) throughput is reported,
+which is the least sensitive to other load on the machine. Results are
+written as JSON with one benchmark per line, e.g.:
+
+{"opensim_version": "4.1", "benchmarks": [
+{"name": "forward_arm26", "unit": "simulated s/s", "value": 1.234, ...}
+]}
+
+Given a baseline file written by an earlier run (--baseline), every
+benchmark that is slower than the baseline by more than the tolerance is
+reported as a regression and the program exits with a nonzero status.
+
+//=============================================================================*/
+#include <OpenSim/Common/About.h>
+#include <OpenSim/Common/Adapters.h>
+#include <OpenSim/Common/IO.h>
+#include <OpenSim/Common/Lmdif.h>
+#include <OpenSim/Common/Storage.h>
+#include <OpenSim/Simulation/Model/Model.h>
+#include <OpenSim/Simulation/Model/ModelCache.h>
+#include <OpenSim/Simulation/Manager/Manager.h>
+#include <OpenSim/Simulation/Model/Umberger2010MuscleMetabolicsProbe.h>
+#include <OpenSim/Simulation/Wrap/WrapMath.h>
+#include <OpenSim/Analyses/MuscleAnalysis.h>
+#include <OpenSim/Analyses/StaticOptimization.h>
+#include <OpenSim/Tools/AnalyzeTool.h>
+#include <OpenSim/Tools/InverseDynamicsTool.h>
+#include <OpenSim/Tools/InverseKinematicsTool.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace OpenSim;
+using std::cout;
+using std::endl;
+using std::string;
+
+namespace {
+
+struct Options {
+    bool quick = false;
+    int repeats = 3;
+    string filter;
+    string outputFile = "osimBenchmarks.json";
+    string baselineFile;
+    double tolerance = 0.10;
+};
+
+struct Result {
+    string name;
+    string unit;
+    double value = 0;       // best throughput over the repeats
+    double wallTime = 0;    // wall time (s) of the best repeat
+    double work = 0;        // units of work per repeat
+};
+
+using Clock = std::chrono::steady_clock;
+
+// A benchmark performs one repeat of its workload and returns the amount of
+// work done (frames, simulated seconds, megabytes, ...). Setup that should
+// not be timed is done in `setup`, which is called before every repeat.
+struct Benchmark {
+    string name;
+    string unit;
+    std::function<void()> setup;
+    std::function<double()> run;
+};
+
+Result runBenchmark(const Benchmark& benchmark, const Options& options) {
+    Result result;
+    result.name = benchmark.name;
+    result.unit = benchmark.unit;
+    const int repeats = options.quick ? 1 : options.repeats;
+    for (int i = 0; i < repeats; ++i) {
+        if (benchmark.setup) benchmark.setup();
+        const auto start = Clock::now();
+        const double work = benchmark.run();
+        const double wallTime =
+                std::chrono::duration<double>(Clock::now() - start).count();
+        const double throughput = work / wallTime;
+        if (throughput > result.value) {
+            result.value = throughput;
+            result.wallTime = wallTime;
+            result.work = work;
+        }
+    }
+    return result;
+}
+
+double fileSizeInMB(const string& fileName) {
+    std::ifstream file(fileName, std::ios::binary | std::ios::ate);
+    OPENSIM_THROW_IF(!file.good(), FileDoesNotExist, fileName);
+    return double(file.tellg()) / (1024.0 * 1024.0);
+}
+
+// Simulate `modelFile` from its default state for `finalTime` seconds.
+double simulate(const string& modelFile, double finalTime) {
+    Model model(modelFile);
+    SimTK::State& state = model.initSystem();
+    model.equilibrateMuscles(state);
+    Manager manager(model);
+    manager.setPerformAnalyses(false);
+    manager.setWriteToStorage(false);
+    manager.initialize(state);
+    manager.integrate(finalTime);
+    return finalTime;
+}
+
+// Simulate gait10dof for `finalTime` seconds with a metabolics probe that
+// reports the first `numMuscles` muscles separately. The cost of the probe
+// should grow linearly with the number of muscles reported.
+double simulateMetabolics(int numMuscles, double finalTime) {
+    Model model("gait10dof18musc_subject01.osim");
+    auto* probe = new Umberger2010MuscleMetabolicsProbe();
+    probe->setName("metabolics");
+    probe->set_report_total_metabolics_only(false);
+    probe->setOperation("integrate");
+    const auto& muscles = model.getMuscles();
+    for (int i = 0; i < std::min(numMuscles, muscles.getSize()); ++i)
+        probe->addMuscle(muscles[i].getName(), 0.5);
+    model.addProbe(probe);
+    SimTK::State& state = model.initSystem();
+    model.equilibrateMuscles(state);
+    Manager manager(model);
+    manager.setPerformAnalyses(false);
+    manager.setWriteToStorage(false);
+    manager.initialize(state);
+    manager.integrate(finalTime);
+    return finalTime;
+}
+
+// Run an analysis over the first `numFrames` rows of the walking states.
+double analyze(Analysis* analysis, Model& model, int numFrames) {
+    const Storage states("std_subject01_walk1_states.sto");
+    model.addAnalysis(analysis);
+    analysis->setModel(model);
+    SimTK::State& s = model.initSystem();
+    const int finalFrame = std::min(numFrames, states.getSize()) - 1;
+    AnalyzeTool::run(s, model, 0, finalFrame, states, false);
+    return finalFrame + 1;
+}
+
+// Lines passing near a circle of unit radius in the Z=0 plane, as seen by
+// a muscle wrapping over a torus: each line moves a little from one to the
+// next, like a path segment from one time step to the next.
+struct TorusLine { SimTK::Vec3 p1, line; double length; };
+std::vector<TorusLine> createTorusLines(int numLines) {
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+    std::vector<TorusLine> lines(numLines);
+    SimTK::Vec3 p1(0.3, -1.5, 0.2), p2(0.8, 1.5, -0.1);
+    for (auto& line : lines) {
+        for (int i = 0; i < 3; ++i) {
+            p1[i] += 0.01 * uniform(generator);
+            p2[i] += 0.01 * uniform(generator);
+        }
+        line.p1 = p1;
+        line.line = (p2 - p1).normalize();
+        line.length = (p2 - p1).norm();
+    }
+    return lines;
+}
+
+// The squared distance from the circle to the point t of the line.
+double calcTorusDistanceSquared(const TorusLine& line, double t) {
+    const SimTK::Vec3 x = line.p1 + t * line.line;
+    return x.normSqr() + 1.0 - 2.0 * std::sqrt(x[0]*x[0] + x[1]*x[1]);
+}
+
+// The closest point as formerly computed by WrapTorus: a Levenberg-Marquardt
+// solve of the stationarity of the distance starting from each end of the
+// line, of which the nearer result is kept. The residual is the former one,
+// whose circle term is twice the derivative of the distance.
+void calcTorusResidual(int, int, double q[], double resid[], int*, void* ptr) {
+    const TorusLine& line = *static_cast<const TorusLine*>(ptr);
+    const SimTK::Vec3 x = line.p1 + q[0] * line.line;
+    const double s = x[0]*line.line[0] + x[1]*line.line[1];
+    resid[0] = 2.0 * (~x * line.line) -
+               4.0 * s / std::sqrt(x[0]*x[0] + x[1]*x[1]);
+}
+double findTorusClosestPointLmdif(const TorusLine& line) {
+    double best = 0, bestDistance = SimTK::Infinity;
+    for (const double sign : {1.0, -1.0}) {
+        const double length = sign > 0 ? 0.0 : line.length;
+        const TorusLine start{line.p1 + length * line.line, sign * line.line,
+                              line.length};
+        int info, numCalls, ipvt[2];
+        double q[2] = {0, 0}, resid[2], fjac[2], diag[2], qtf[2];
+        double wa1[2], wa2[2], wa3[2], wa4[2];
+        lmdif_C(calcTorusResidual, 1, 1, q, resid, 1e-4, 1e-4, 0.0, 500,
+                0.0, diag, 1, 0.2, 0, &info, &numCalls, fjac, 1, ipvt, qtf,
+                wa1, wa2, wa3, wa4, (void*)&start);
+        const double t = length + sign * q[0];
+        const double distance = calcTorusDistanceSquared(line, t);
+        if (distance < bestDistance) { best = t; bestDistance = distance; }
+    }
+    return best;
+}
+
+// Solve for the closest point of every line with `solve` and report the
+// largest excess of the distance over that of the quartic solution, which
+// `setup` computes beforehand.
+struct TorusBenchmark {
+    std::vector<TorusLine> lines;
+    std::vector<double> exactDistances;
+    void setup(int numLines) {
+        if ((int)lines.size() == numLines) return;
+        lines = createTorusLines(numLines);
+        exactDistances.clear();
+        for (const auto& line : lines) {
+            double t[2];
+            WrapMath::CalcClosestPointsOnLineToCircle(1.0, line.p1, line.line,
+                                                      t);
+            exactDistances.push_back(calcTorusDistanceSquared(line, t[0]));
+        }
+    }
+    double run(const string& name, const std::function<double(size_t)>& solve)
+    {
+        double worst = 0;
+        for (size_t i = 0; i < lines.size(); ++i) {
+            const double distance =
+                    calcTorusDistanceSquared(lines[i], solve(i));
+            worst = std::max(worst, distance - exactDistances[i]);
+        }
+        cout << "  " << name << ": largest excess squared distance " << worst
+             << endl;
+        return double(lines.size());
+    }
+};
+
+std::vector<Benchmark> createBenchmarks(const Options& options) {
+    const bool quick = options.quick;
+    std::vector<Benchmark> benchmarks;
+
+    benchmarks.push_back({"model_loading", "models/s", nullptr, [quick]() {
+        const int numLoads = quick ? 1 : 5;
+        for (int i = 0; i < numLoads; ++i) {
+            for (const string& file : {"arm26.osim",
+                    "gait10dof18musc_subject01.osim",
+                    "gait2354_simbody.osim"}) {
+                Model model(file);
+                model.initSystem();
+            }
+        }
+        return 3.0 * numLoads;
+    }});
+
+    // The copies are written by the untimed setup, so that every timed load
+    // reads them.
+    const std::vector<string> modelFiles{"arm26.osim",
+            "gait10dof18musc_subject01.osim", "gait2354_simbody.osim"};
+    auto cache = std::make_shared<ModelCache>("osimBenchmarks_modelcache");
+    benchmarks.push_back({"model_loading_cached", "models/s",
+        [cache, modelFiles]() {
+            for (const string& file : modelFiles) cache->load(file);
+        },
+        [quick, cache, modelFiles]() {
+            const int numLoads = quick ? 1 : 5;
+            for (int i = 0; i < numLoads; ++i) {
+                for (const string& file : modelFiles) {
+                    std::unique_ptr<Model> model = cache->load(file);
+                    model->initSystem();
+                }
+            }
+            return double(modelFiles.size() * numLoads);
+        }});
+
+    benchmarks.push_back({"forward_arm26", "simulated s/s", nullptr,
+        [quick]() { return simulate("arm26.osim", quick ? 0.05 : 1.0); }});
+
+    benchmarks.push_back({"forward_gait10dof", "simulated s/s", nullptr,
+        [quick]() {
+            return simulate("gait10dof18musc_subject01.osim",
+                            quick ? 0.01 : 0.2);
+        }});
+
+    for (int numMuscles : {1, 6, 18}) {
+        benchmarks.push_back({"forward_metabolics_" + std::to_string(numMuscles),
+            "simulated s/s", nullptr, [quick, numMuscles]() {
+                return simulateMetabolics(numMuscles, quick ? 0.01 : 0.2);
+            }});
+    }
+
+    benchmarks.push_back({"inverse_kinematics", "frames/s", nullptr,
+        [quick]() {
+            const string markerFile = "gait10dof18musc_walk_CRLF_line_ending.trc";
+            const int numFrames = TimeSeriesTableVec3(markerFile).getNumRows();
+            const int numTrials = quick ? 1 : 10;
+            for (int i = 0; i < numTrials; ++i) {
+                Model model("gait10dof18musc_subject01.osim");
+                InverseKinematicsTool ik;
+                ik.setModel(model);
+                ik.setMarkerDataFileName(markerFile);
+                ik.setStartTime(-SimTK::Infinity);
+                ik.setEndTime(SimTK::Infinity);
+                ik.setResultsDir("osimBenchmarks_results");
+                ik.setOutputMotionFileName(
+                        "osimBenchmarks_results/benchmark_ik.mot");
+                ik.run();
+            }
+            return double(numTrials * numFrames);
+        }});
+
+    benchmarks.push_back({"inverse_dynamics", "frames/s", nullptr,
+        [quick]() {
+            const string coordinatesFile =
+                    "gait10dof18musc_ik_CRLF_line_ending.mot";
+            const int numFrames = Storage(coordinatesFile).getSize();
+            const int numTrials = quick ? 1 : 10;
+            for (int i = 0; i < numTrials; ++i) {
+                Model model("gait10dof18musc_subject01.osim");
+                InverseDynamicsTool id;
+                id.setModel(model);
+                id.setCoordinatesFileName(coordinatesFile);
+                id.setLowpassCutoffFrequency(6.0);
+                id.setStartTime(-SimTK::Infinity);
+                id.setEndTime(SimTK::Infinity);
+                id.setResultsDir("osimBenchmarks_results");
+                id.setOutputGenForceFileName("benchmark_id.sto");
+                id.run();
+            }
+            return double(numTrials * numFrames);
+        }});
+
+    benchmarks.push_back({"static_optimization", "frames/s", nullptr,
+        [quick]() {
+            Model model("gait2354_simbody.osim");
+            return analyze(new StaticOptimization(&model), model,
+                           quick ? 5 : 100);
+        }});
+
+    benchmarks.push_back({"muscle_analysis", "frames/s", nullptr,
+        [quick]() {
+            Model model("gait2354_simbody.osim");
+            return analyze(new MuscleAnalysis(&model), model,
+                           quick ? 5 : 200);
+        }});
+
+    const int numTorusLines = quick ? 1000 : 100000;
+    auto torus = std::make_shared<TorusBenchmark>();
+    auto setupTorus = [torus, numTorusLines]() { torus->setup(numTorusLines); };
+    benchmarks.push_back({"wrap_torus_quartic", "solves/s", setupTorus,
+        [torus]() {
+            return torus->run("quartic", [torus](size_t i) {
+                double t[2];
+                WrapMath::CalcClosestPointsOnLineToCircle(1.0,
+                        torus->lines[i].p1, torus->lines[i].line, t);
+                return t[0];
+            });
+        }});
+
+    benchmarks.push_back({"wrap_torus_warm", "solves/s", setupTorus,
+        [torus]() {
+            double previous = 0;
+            return torus->run("warm", [torus, &previous](size_t i) {
+                const TorusLine& line = torus->lines[i];
+                double t[2] = {previous, 0};
+                if (i == 0 || !WrapMath::RefineClosestPointOnLineToCircle(
+                            1.0, line.p1, line.line, t[0], 4))
+                    WrapMath::CalcClosestPointsOnLineToCircle(1.0, line.p1,
+                                                              line.line, t);
+                return previous = t[0];
+            });
+        }});
+
+    benchmarks.push_back({"wrap_torus_lmdif", "solves/s", setupTorus,
+        [torus]() {
+            return torus->run("lmdif", [torus](size_t i) {
+                return findTorusClosestPointLmdif(torus->lines[i]);
+            });
+        }});
+
+    benchmarks.push_back({"read_sto", "MB/s", nullptr, []() {
+        const string file = "std_subject01_walk1_states.sto";
+        TimeSeriesTable table(file);
+        return fileSizeInMB(file);
+    }});
+
+    benchmarks.push_back({"read_sto_storage", "MB/s", nullptr, []() {
+        const string file = "std_subject01_walk1_states.sto";
+        Storage storage(file);
+        return fileSizeInMB(file);
+    }});
+
+    benchmarks.push_back({"read_trc", "MB/s", nullptr, [quick]() {
+        const string file = "gait10dof18musc_walk_CRLF_line_ending.trc";
+        // The file is small; read it several times for a stable measure.
+        const int numReads = quick ? 1 : 50;
+        for (int i = 0; i < numReads; ++i) TimeSeriesTableVec3 table(file);
+        return numReads * fileSizeInMB(file);
+    }});
+
+    benchmarks.push_back({"read_c3d_native", "MB/s", nullptr, []() {
+        const string file = "walking2.c3d";
+        NativeC3DFileAdapter{}.read(file);
+        return fileSizeInMB(file);
+    }});
+
+#ifdef WITH_BTK
+    benchmarks.push_back({"read_c3d", "MB/s", nullptr, []() {
+        const string file = "walking2.c3d";
+        C3DFileAdapter::readFile(file);
+        return fileSizeInMB(file);
+    }});
+#endif
+
+    return benchmarks;
+}
+
+void writeResults(const std::vector<Result>& results, const string& fileName) {
+    std::ofstream out(fileName);
+    OPENSIM_THROW_IF(!out.good(), Exception,
+            "Could not open file '" + fileName + "' for writing.");
+    out << "{\"opensim_version\": \"" << GetVersion() << "\", "
+        << "\"benchmarks\": [\n";
+    out << std::setprecision(8);
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Result& r = results[i];
+        out << "{\"name\": \"" << r.name << "\", \"unit\": \"" << r.unit
+            << "\", \"value\": " << r.value
+            << ", \"wall_time\": " << r.wallTime
+            << ", \"work\": " << r.work << "}"
+            << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    out << "]}\n";
+}
+
+// Read the values of a results file written by writeResults().
+std::map<string, double> readBaseline(const string& fileName) {
+    std::ifstream in(fileName);
+    OPENSIM_THROW_IF(!in.good(), FileDoesNotExist, fileName);
+    std::map<string, double> values;
+    const string nameKey = "\"name\": \"";
+    const string valueKey = "\"value\": ";
+    string line;
+    while (std::getline(in, line)) {
+        const auto namePos = line.find(nameKey);
+        const auto valuePos = line.find(valueKey);
+        if (namePos == string::npos || valuePos == string::npos) continue;
+        const auto nameStart = namePos + nameKey.size();
+        const string name =
+                line.substr(nameStart, line.find('"', nameStart) - nameStart);
+        values[name] = std::stod(line.substr(valuePos + valueKey.size()));
+    }
+    return values;
+}
+
+void printUsage() {
+    cout << "Usage: osimBenchmarks [options]\n"
+         << "  --quick             Run each workload once, at a small size.\n"
+         << "  --repeat N          Repeats per benchmark (default 3); the\n"
+         << "                      best throughput is reported.\n"
+         << "  --filter TEXT       Run only benchmarks whose name contains\n"
+         << "                      TEXT.\n"
+         << "  --output FILE       JSON results file\n"
+         << "                      (default osimBenchmarks.json).\n"
+         << "  --baseline FILE     Compare against an earlier results file.\n"
+         << "  --tolerance X       Allowed slowdown relative to the baseline\n"
+         << "                      (default 0.10, i.e., 10%)." << endl;
+}
+
+} // anonymous namespace
+
+int main(int argc, char* argv[]) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--quick") options.quick = true;
+        else if (arg == "--repeat" && hasValue)
+            options.repeats = std::max(1, std::stoi(argv[++i]));
+        else if (arg == "--filter" && hasValue) options.filter = argv[++i];
+        else if (arg == "--output" && hasValue) options.outputFile = argv[++i];
+        else if (arg == "--baseline" && hasValue)
+            options.baselineFile = argv[++i];
+        else if (arg == "--tolerance" && hasValue)
+            options.tolerance = std::stod(argv[++i]);
+        else {
+            printUsage();
+            return arg == "--help" || arg == "-h" ? 0 : 1;
+        }
+    }
+
+    try {
+        IO::makeDir("osimBenchmarks_results");
+
+        std::vector<Result> results;
+        for (const Benchmark& benchmark : createBenchmarks(options)) {
+            if (!options.filter.empty() &&
+                    benchmark.name.find(options.filter) == string::npos)
+                continue;
+            cout << "Running benchmark " << benchmark.name << "..." << endl;
+            results.push_back(runBenchmark(benchmark, options));
+        }
+
+        writeResults(results, options.outputFile);
+
+        std::map<string, double> baseline;
+        if (!options.baselineFile.empty())
+            baseline = readBaseline(options.baselineFile);
+
+        int numRegressions = 0;
+        cout << "\n" << std::left << std::setw(24) << "benchmark"
+             << std::right << std::setw(16) << "throughput"
+             << "  " << std::left << std::setw(16) << "unit"
+             << std::right << std::setw(12) << "wall (s)";
+        if (!baseline.empty()) cout << std::setw(12) << "vs. base";
+        cout << "\n";
+        for (const Result& r : results) {
+            cout << std::left << std::setw(24) << r.name
+                 << std::right << std::setw(16) << std::setprecision(6)
+                 << r.value << "  " << std::left << std::setw(16) << r.unit
+                 << std::right << std::setw(12) << r.wallTime;
+            const auto it = baseline.find(r.name);
+            if (it != baseline.end() && it->second > 0) {
+                const double ratio = r.value / it->second;
+                cout << std::setw(11) << std::setprecision(3) << ratio << "x";
+                if (ratio < 1.0 - options.tolerance) {
+                    cout << "  REGRESSION";
+                    ++numRegressions;
+                }
+            }
+            cout << "\n";
+        }
+        cout << "\nWrote " << options.outputFile << endl;
+
+        if (numRegressions > 0) {
+            cout << numRegressions << " benchmark(s) regressed by more than "
+                 << 100 * options.tolerance << "% relative to "
+                 << options.baselineFile << "." << endl;
+            return 1;
+        }
+    } catch (const std::exception& e) {
+        cout << "osimBenchmarks failed: " << e.what() << endl;
+        return 1;
+    }
+    return 0;
+}
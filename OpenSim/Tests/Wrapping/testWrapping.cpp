@@ -47,6 +47,7 @@ public:
 };
 
 void testWrapCylinder();
+void testTorusClosestPoint();
 void testWrapObjectUpdateFromXMLNode30515();
 void simulate(Model& osimModel, State& si, double initialTime, double finalTime);
 void simulateModelWithMusclesNoViz(const string &modelFile, double finalTime, double activation=0.5);
@@ -67,6 +68,13 @@ int main()
         std::cout << "Exception: " << e.what() << std::endl;
         failures.push_back("TestShoulderModel (multiple wrap)"); }
 
+    try{
+        testTorusClosestPoint();
+    } catch (const std::exception& e) {
+        std::cout << "Exception: " << e.what() << std::endl;
+        failures.push_back("testTorusClosestPoint");
+    }
+
     try{
         testWrapObjectUpdateFromXMLNode30515();
     } catch (const std::exception& e) {
@@ -405,6 +413,55 @@ void testWrapCylinder()
 }
 
 
+// Squared distance between the circle of radius r in the Z=0 plane and the
+// point t of the line.
+double calcDistanceSquaredToCircle(double r, const Vec3& p, const Vec3& line,
+                                   double t)
+{
+    const Vec3 x = p + t * line;
+    return x.normSqr() + r*r - 2*r*std::sqrt(x[0]*x[0] + x[1]*x[1]);
+}
+
+void testTorusClosestPoint()
+{
+    const double r = 0.05;
+    // Lines crossing the hole of the torus (two minima), passing over it
+    // parallel to the x axis, outside of it, skew, and parallel to its axis.
+    const std::vector<std::pair<Vec3, Vec3>> lines = {
+        {Vec3(-0.1, 0.01, 0.02), Vec3(0.1, -0.01, 0.0)},
+        {Vec3(-0.1, 0.02, 0.03), Vec3(0.1, 0.02, 0.03)},
+        {Vec3(-0.1, 0.08, 0.03), Vec3(0.1, 0.08, 0.03)},
+        {Vec3(-0.07, -0.02, -0.04), Vec3(0.03, 0.09, 0.05)},
+        {Vec3(0.02, 0.03, -0.1), Vec3(0.02, 0.03, 0.1)}};
+
+    for (const auto& ends : lines) {
+        const Vec3 p = ends.first;
+        const Vec3 line = (ends.second - ends.first).normalize();
+        double t[2];
+        const int numPts =
+                WrapMath::CalcClosestPointsOnLineToCircle(r, p, line, t);
+        ASSERT(numPts >= 1 && numPts <= 2);
+
+        // No point of the line is closer than the first one found.
+        double nearest = SimTK::Infinity;
+        for (int i = -20000; i <= 20000; ++i)
+            nearest = std::min(nearest,
+                    calcDistanceSquaredToCircle(r, p, line, i * 1e-5));
+        const double d0 = calcDistanceSquaredToCircle(r, p, line, t[0]);
+        ASSERT(d0 <= nearest + 1e-12);
+        if (numPts == 2)
+            ASSERT(calcDistanceSquaredToCircle(r, p, line, t[1]) >= d0);
+
+        // Newton steps from a nearby estimate return to the same point.
+        for (int i = 0; i < numPts; ++i) {
+            double estimate = t[i] + 0.002;
+            ASSERT(WrapMath::RefineClosestPointOnLineToCircle(r, p, line,
+                    estimate, 6));
+            ASSERT_EQUAL(t[i], estimate, 1e-10);
+        }
+    }
+}
+
 void simulateModelWithMusclesNoViz(const string &modelFile, double finalTime, double activation)
 {
     // Create a new OpenSim model
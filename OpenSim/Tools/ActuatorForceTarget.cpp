@@ -133,23 +133,31 @@ prepareToOptimize(SimTK::State& s, double *x)
     _forcePerformanceMatrix.resize(nf,nf);
     _forcePerformanceVector.resize(nf);
 
-    Vector f(nf), accelVec(nacc), forceVec(nf);
-
     // Build matrices and vectors assuming performance is a linear least squares problem.
     // i.e. assume we're solving
     //   min || _accelPerformanceMatrix * x + _accelPerformanceVector ||^2 + || _forcePerformanceMatrix * x + _forcePerformanceVector || ^2
-    f = 0;
-    computePerformanceVectors(s, f, _accelPerformanceVector, _forcePerformanceVector);
-
+    // The acceleration terms come from the map of actuator forces to task
+    // accelerations; the stress of each actuator depends only on its own force.
+    Vector a0, unitStress;
+    Matrix dadf;
+    _controller->computeActuatorAccelerationMap(s, a0, dadf, unitStress);
 
-    for(int j=0; j<nf; j++) {
-        f[j] = 1;
-        computePerformanceVectors(s, f, accelVec, forceVec);
-        for(int i=0; i<nacc; i++) _accelPerformanceMatrix(i,j) = (accelVec[i] - _accelPerformanceVector[i]);
-        for(int i=0; i<nf; i++) _forcePerformanceMatrix(i,j) = (forceVec[i] - _forcePerformanceVector[i]);
-        f[j] = 0;
+    CMC_TaskSet& taskSet = _controller->updTaskSet();
+    Array<double> &w = taskSet.getWeights();
+    Array<double> &aDes = taskSet.getDesiredAccelerations();
+    for(int i=0; i<nacc; i++) {
+        double sqrtWeight = sqrt(w[i]);
+        _accelPerformanceVector[i] = sqrtWeight * (a0[i] - aDes[i]);
+        for(int j=0; j<nf; j++)
+            _accelPerformanceMatrix(i,j) = sqrtWeight * dadf(i,j);
     }
 
+    double sqrtStressTermWeight = sqrt(_stressTermWeight);
+    _forcePerformanceMatrix = 0;
+    _forcePerformanceVector = 0;
+    for(int j=0; j<nf; j++)
+        _forcePerformanceMatrix(j,j) = sqrtStressTermWeight * unitStress[j];
+
 #ifdef USE_LAPACK_DIRECT_SOLVE
     // 
     // Try to solve using lapack
@@ -124,18 +124,19 @@ prepareToOptimize(SimTK::State& s, double *x)
     _constraintMatrix.resize(nc,nf);
     _constraintVector.resize(nc);
 
-    Vector f(nf), c(nc);
+    // Build linear constraint matrix and constant constraint vector from the
+    // map of actuator forces to task accelerations: c = w*(aDes - a).
+    Vector a0, unitStress;
+    Matrix dadf;
+    _controller->computeActuatorAccelerationMap(s, a0, dadf, unitStress);
 
-    // Build linear constraint matrix and constant constraint vector
-    f = 0;
-
-    computeConstraintVector(s, f, _constraintVector);
-
-    for(int j=0; j<nf; j++) {
-        f[j] = 1;
-        computeConstraintVector(s, f, c);
-        _constraintMatrix(j) = (c - _constraintVector);
-        f[j] = 0;
+    CMC_TaskSet& taskSet = _controller->updTaskSet();
+    Array<double> &w = taskSet.getWeights();
+    Array<double> &aDes = taskSet.getDesiredAccelerations();
+    for(int i=0; i<nc; i++) {
+        _constraintVector[i] = w[i]*(aDes[i]-a0[i]);
+        for(int j=0; j<nf; j++)
+            _constraintMatrix(i,j) = -w[i]*dadf(i,j);
     }
 #endif
 
@@ -35,6 +35,12 @@
 #include <OpenSim/Simulation/Model/PrescribedForce.h>
 #include <OpenSim/Actuators/Thelen2003Muscle.h>
 
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <thread>
+
 using namespace OpenSim;
 using namespace std;
 
@@ -196,6 +202,9 @@ setNull()
 
     _printResultFiles = true;
     _replaceForceSet = false;
+
+    _numThreads = 1;
+    _parallelMode = ParallelOverFrames;
 }
 //_____________________________________________________________________________
 /**
@@ -261,6 +270,8 @@ operator=(const AnalyzeTool &aTool)
     _lowpassCutoffFrequency= aTool._lowpassCutoffFrequency;
     _statesStore = aTool._statesStore;
     _printResultFiles = aTool._printResultFiles;
+    _numThreads = aTool._numThreads;
+    _parallelMode = aTool._parallelMode;
     return(*this);
 }
 
@@ -525,11 +536,11 @@ bool AnalyzeTool::run(bool plotting)
         throw(Exception(msg,__FILE__,__LINE__));
     }
 
-    // Do the maneuver to change then restore working directory 
+    // Resolve relative file names against the directory of the setup file
     // so that the parsing code behaves properly if called from a different directory.
-    string saveWorkingDirectory = IO::getCwd();
-    if (getDocument())  // When the tool is created live from GUI it has no file/document association
-        IO::chDir(IO::getParentDirectory(getDocumentFileName()));
+    // When the tool is created live from GUI it has no file/document association.
+    ScopedBaseDirectory directoryOfSetupFile(getDocument() ?
+            IO::getParentDirectory(getDocumentFileName()) : std::string());
     // Use the Dynamics Tool API to handle external loads instead of outdated AbstractTool
     /*bool externalLoads = */createExternalLoads(_externalLoadsFileName, *_model);
 
@@ -579,12 +590,12 @@ bool AnalyzeTool::run(bool plotting)
     //}
 
     cout<<"Executing the analyses from "<<ti<<" to "<<tf<<"..."<<endl;
-    run(s, *_model, iInitial, iFinal, *_statesStore, _solveForEquilibriumForAuxiliaryStates);
+    run(s, *_model, iInitial, iFinal, *_statesStore, _solveForEquilibriumForAuxiliaryStates,
+        _numThreads, _parallelMode);
     _model->getMultibodySystem().realize(s, SimTK::Stage::Position );
     } catch (const Exception& x) {
         x.print(cout);
         completed = false;
-        IO::chDir(saveWorkingDirectory);
         throw Exception(x.what(),__FILE__,__LINE__);
     }
 
@@ -593,7 +604,6 @@ bool AnalyzeTool::run(bool plotting)
     if (completed && _printResultFiles)
         printResults(getName(),getResultsDir()); // this will create results directory if necessary
 
-    IO::chDir(saveWorkingDirectory);
 
     removeExternalLoadsFromModel();
 
@@ -698,3 +708,133 @@ void AnalyzeTool::run(SimTK::State& s, Model &aModel, int iInitial, int iFinal,
         }
     }
 }
+
+//_____________________________________________________________________________
+/**
+ * Run the analyses of aModel over the frames iInitial to iFinal with
+ * numThreads threads. The calling thread works on aModel; every other thread
+ * works on a clone of aModel (with clones of its analyses) and on a copy of
+ * the states storage, since neither a model nor a Storage may be used by two
+ * threads at once. The models are cloned and initialized serially, before
+ * any thread starts, from the state s so that they are not assembled again.
+ * The results of the clones are then gathered into the
+ * storages that the analyses of aModel list in getStorageList().
+ */
+void AnalyzeTool::run(SimTK::State& s, Model &aModel, int iInitial, int iFinal, const Storage &aStatesStore, bool aSolveForEquilibrium,
+                      int numThreads, ParallelMode mode)
+{
+    if(numThreads <= 0)
+        numThreads = std::max(1, (int)std::thread::hardware_concurrency());
+
+    AnalysisSet& analysisSet = aModel.updAnalysisSet();
+    const Array<bool> on = analysisSet.getOn();
+    std::vector<int> active;
+    for(int i=0;i<analysisSet.getSize();i++)
+        if(on[i]) active.push_back(i);
+
+    const int numTasks = (mode == ParallelOverFrames)
+            ? std::min(numThreads, iFinal - iInitial + 1)
+            : std::min(numThreads, (int)active.size());
+    if(numTasks <= 1) {
+        run(s, aModel, iInitial, iFinal, aStatesStore, aSolveForEquilibrium);
+        return;
+    }
+
+    // Each task covers a range of frames with a subset of the analyses.
+    struct Task {
+        int first, last;
+        Array<bool> on;
+        std::unique_ptr<Model> model;
+        std::unique_ptr<Storage> statesStore;
+        SimTK::State* state;
+        std::exception_ptr error;
+    };
+    std::vector<Task> tasks(numTasks);
+    const int numFrames = iFinal - iInitial + 1;
+    for(int k=0;k<numTasks;k++) {
+        Task& task = tasks[k];
+        if(mode == ParallelOverFrames) {
+            task.first = iInitial + (k*numFrames)/numTasks;
+            task.last = iInitial + ((k+1)*numFrames)/numTasks - 1;
+            task.on = on;
+        } else {
+            task.first = iInitial;
+            task.last = iFinal;
+            task.on = Array<bool>(false, analysisSet.getSize());
+            for(int a=k;a<(int)active.size();a+=numTasks)
+                task.on[active[a]] = true;
+        }
+        if(k == 0) {
+            task.state = &s;
+        } else {
+            task.model.reset(aModel.clone());
+            task.state = &task.model->initSystem(s);
+            task.model->updAnalysisSet().setOn(task.on);
+            task.statesStore.reset(new Storage(aStatesStore));
+        }
+    }
+
+    auto runTask = [&](Task& task) {
+        try {
+            if(task.model)
+                AnalyzeTool::run(*task.state, *task.model, task.first, task.last,
+                    *task.statesStore, aSolveForEquilibrium);
+            else
+                AnalyzeTool::run(*task.state, aModel, task.first, task.last,
+                    aStatesStore, aSolveForEquilibrium);
+        } catch(...) {
+            task.error = std::current_exception();
+        }
+    };
+
+    analysisSet.setOn(tasks[0].on);
+    std::vector<std::thread> threads;
+    for(int k=1;k<numTasks;k++)
+        threads.emplace_back(runTask, std::ref(tasks[k]));
+    runTask(tasks[0]);
+    for(auto& thread : threads) thread.join();
+
+    // The analyses of aModel that were run by other threads have not begun;
+    // begin them at the first frame so that they allocate their storages.
+    if(mode == ParallelOverAnalyses && !tasks[0].error) {
+        Array<bool> others(false, analysisSet.getSize());
+        for(int k=1;k<numTasks;k++)
+            for(int i=0;i<analysisSet.getSize();i++)
+                if(tasks[k].on[i]) others[i] = true;
+        analysisSet.setOn(others);
+        try {
+            run(s, aModel, iInitial, iInitial, aStatesStore, aSolveForEquilibrium);
+        } catch(...) {
+            tasks[0].error = std::current_exception();
+        }
+    }
+    analysisSet.setOn(on);
+
+    for(const Task& task : tasks)
+        if(task.error) std::rethrow_exception(task.error);
+
+    // GATHER THE RESULTS
+    for(int k=1;k<numTasks;k++) {
+        AnalysisSet& taskAnalyses = tasks[k].model->updAnalysisSet();
+        for(int i=0;i<analysisSet.getSize();i++) {
+            if(!tasks[k].on[i]) continue;
+            Analysis& analysis = analysisSet.get(i);
+            ArrayPtrs<Storage>& results = analysis.getStorageList();
+            ArrayPtrs<Storage>& taskResults = taskAnalyses.get(i).getStorageList();
+            if(results.getSize()==0 || results.getSize()!=taskResults.getSize()) {
+                string msg = "AnalyzeTool.run: ERROR- Analysis '" + analysis.getName() +
+                    "' does not list its result storages in getStorageList(), so it cannot be run"
+                    " with more than one thread. Set the number of threads to 1.";
+                throw Exception(msg,__FILE__,__LINE__);
+            }
+            for(int m=0;m<results.getSize();m++) {
+                if(mode == ParallelOverAnalyses) {
+                    *results[m] = *taskResults[m];
+                } else {
+                    for(int r=0;r<taskResults[m]->getSize();r++)
+                        results[m]->append(*taskResults[m]->getStateVector(r));
+                }
+            }
+        }
+    }
+}
@@ -52,6 +52,20 @@ namespace OpenSim {
 class OSIMTOOLS_API AnalyzeTool : public AbstractTool {
 OpenSim_DECLARE_CONCRETE_OBJECT(AnalyzeTool, AbstractTool);
 
+public:
+    /** How the work is divided when the analyses are run with more than
+     * one thread (see setNumThreads()). */
+    enum ParallelMode {
+        /** Each thread runs all the analyses on a contiguous block of
+         * frames using its own copy of the model; the results of the blocks
+         * are appended in order. Every analysis must compute each frame
+         * independently of the others. */
+        ParallelOverFrames,
+        /** Each thread runs a subset of the analyses on all the frames using
+         * its own copy of the model. */
+        ParallelOverAnalyses
+    };
+
 //=============================================================================
 // MEMBER VARIABLES
 //=============================================================================
@@ -77,6 +91,11 @@ private:
 
     /** Whether the model and states should be loaded from input files */
     bool _loadModelAndInput;
+
+    /** Number of threads used to run the analyses. */
+    int _numThreads;
+    /** How the analyses are divided among the threads. */
+    ParallelMode _parallelMode;
 //=============================================================================
 // METHODS
 //=============================================================================
@@ -121,6 +140,14 @@ public:
     void setLowpassCutoffFrequency(double aLowpassCutoffFrequency) { _lowpassCutoffFrequency = aLowpassCutoffFrequency; }
     const bool getLoadModelAndInput() const { return _loadModelAndInput; }
     void setLoadModelAndInput(bool b) { _loadModelAndInput = b; }
+    /** Run the analyses with `numThreads` threads. The default, 1, runs
+     * them serially on the tool's model; 0 uses one thread per hardware
+     * core. Analyses are only parallelized if they list their result
+     * storages in Analysis::getStorageList(). */
+    int getNumThreads() const { return _numThreads; }
+    void setNumThreads(int numThreads) { _numThreads = numThreads; }
+    ParallelMode getParallelMode() const { return _parallelMode; }
+    void setParallelMode(ParallelMode mode) { _parallelMode = mode; }
 
     //--------------------------------------------------------------------------
     // UTILITIES
@@ -141,6 +168,12 @@ public:
     //--------------------------------------------------------------------------
 #ifndef SWIG
     static void run(SimTK::State& s, Model &aModel, int iInitial, int iFinal, const Storage &aStatesStore, bool aSolveForEquilibrium);
+    /** Same as above, but divide the work among `numThreads` threads, each
+     * with its own clone of `aModel` (and of its analyses). On return, the
+     * analyses of `aModel` hold the results for all the frames, as if they
+     * had been run serially. */
+    static void run(SimTK::State& s, Model &aModel, int iInitial, int iFinal, const Storage &aStatesStore, bool aSolveForEquilibrium,
+                    int numThreads, ParallelMode mode);
 #endif
 //=============================================================================
 };  // END of class AnalyzeTool
@@ -935,6 +935,136 @@ computeControls(SimTK::State& s, ControlSet &controlSet)
     _model->updAnalysisSet().setOn(true);
 }
 
+//_____________________________________________________________________________
+/**
+ * Compute the linear map from actuator forces to task accelerations.
+ *
+ * The generalized accelerations satisfy
+ *
+ *     [ M  ~G ] [ udot   ]   [ f ]
+ *     [ G   0 ] [ lambda ] = [ b ]
+ *
+ * in which only the generalized force f depends on the actuator forces.
+ * The change in udot per unit force of actuator j is therefore the
+ * solution for f = ~J*F_j + tau_j, where F_j and tau_j are the body and
+ * mobility forces the actuator applies with a unit force. The matrix is
+ * factored once for all the actuators, and each task maps the change in
+ * udot to a change in its accelerations.
+ */
+void CMC::
+computeActuatorAccelerationMap(const SimTK::State& s,
+    SimTK::Vector& rA0, SimTK::Matrix& rDADF, SimTK::Vector& rUnitStress) const
+{
+    const SimTK::MultibodySystem& system = getModel().getMultibodySystem();
+    const SimTK::SimbodyMatterSubsystem& matter = getModel().getMatterSubsystem();
+    const Set<const Actuator>& fSet = getActuatorSet();
+    CMC_TaskSet& taskSet = updTaskSet();
+    const int na = fSet.getSize();
+
+    auto actuator = [&](int j) -> const ScalarActuator& {
+        auto act = dynamic_cast<const ScalarActuator*>(&fSet[j]);
+        if(!act)
+            throw OpenSim::Exception("CMC: ERROR- actuator '" + fSet[j].getName() +
+                "' is not a ScalarActuator.",__FILE__,__LINE__);
+        return *act;
+    };
+
+    // TASK ACCELERATIONS WITH NO ACTUATOR FORCES
+    SimTK::State sZero = s;
+    for(int j=0;j<na;j++) {
+        actuator(j).overrideActuation(sZero, true);
+        actuator(j).setOverrideActuation(sZero, 0.0);
+    }
+    system.realize(sZero, SimTK::Stage::Acceleration);
+    taskSet.computeAccelerations(sZero);
+    const Array<double>& a = taskSet.getAccelerations();
+    const int nacc = a.getSize();
+    rA0.resize(nacc);
+    for(int i=0;i<nacc;i++) rA0[i] = a[i];
+
+    rDADF.resize(nacc, na);
+    rUnitStress.resize(na);
+    if(na == 0) return;
+
+    // The analytic map needs every coordinate to be governed by the
+    // equations of motion and every task to provide its sensitivity.
+    bool analytic = true;
+    const CoordinateSet& coords = getModel().getCoordinateSet();
+    for(int i=0;i<coords.getSize() && analytic;i++)
+        if(coords.get(i).isPrescribed(sZero)) analytic = false;
+    SimTK::Vec3 da;
+    const SimTK::Vector zero(sZero.getNU(), 0.0);
+    for(int i=0;i<taskSet.getSize() && analytic;i++) {
+        const CMC_Task* task = dynamic_cast<const CMC_Task*>(&taskSet.get(i));
+        if(task && !task->computeAccelerationSensitivity(sZero, zero, da))
+            analytic = false;
+    }
+
+    if(analytic) {
+        // UNIT FORCE OF EACH ACTUATOR
+        // Changing the override value invalidates the Time stage, so the
+        // unit forces are computed on a copy of the state.
+        SimTK::State sUnit = sZero;
+        for(int j=0;j<na;j++) actuator(j).setOverrideActuation(sUnit, 1.0);
+        system.realize(sUnit, SimTK::Stage::Velocity);
+
+        const int nu = sZero.getNU();
+        SimTK::Matrix M, G;
+        matter.calcM(sZero, M);
+        matter.calcG(sZero, G);
+        const int nm = G.nrow();
+        SimTK::Matrix K(nu+nm, nu+nm, 0.0);
+        K(0, 0, nu, nu) = M;
+        if(nm > 0) {
+            K(0, nu, nu, nm) = ~G;
+            K(nu, 0, nm, nu) = G;
+        }
+        SimTK::FactorQTZ kkt(K);
+
+        SimTK::Matrix rhs(nu+nm, na, 0.0);
+        SimTK::Vector_<SimTK::SpatialVec> bodyForces;
+        SimTK::Vector mobilityForces, f;
+        for(int j=0;j<na;j++) {
+            actuator(j).calcForceContribution(sUnit, bodyForces, mobilityForces);
+            matter.multiplyBySystemJacobianTranspose(sUnit, bodyForces, f);
+            f += mobilityForces;
+            rhs(j)(0, nu) = f;
+            rUnitStress[j] = actuator(j).getStress(sUnit);
+        }
+        SimTK::Matrix solution;
+        kkt.solve(rhs, solution);
+
+        // TASK ACCELERATIONS PER UNIT FORCE
+        for(int j=0;j<na;j++) {
+            const SimTK::Vector dudot(solution(j)(0, nu));
+            int k = 0;
+            for(int i=0;i<taskSet.getSize();i++) {
+                const CMC_Task* task =
+                    dynamic_cast<const CMC_Task*>(&taskSet.get(i));
+                if(!task) continue;
+                task->computeAccelerationSensitivity(sZero, dudot, da);
+                for(int c=0;c<3;c++)
+                    if(task->getActive(c)) rDADF(k++, j) = da[c];
+            }
+        }
+        return;
+    }
+
+    // PERTURBATION
+    // Each column requires a realization of the model with a unit force for
+    // one actuator. The realizations are not divided among threads, since
+    // realizing a Model writes to its components (e.g., the wrap points of
+    // its GeometryPaths).
+    for(int j=0;j<na;j++) {
+        SimTK::State sj = sZero;
+        actuator(j).setOverrideActuation(sj, 1.0);
+        system.realize(sj, SimTK::Stage::Acceleration);
+        taskSet.computeAccelerations(sj);
+        for(int i=0;i<nacc;i++) rDADF(i, j) = a[i] - rA0[i];
+        rUnitStress[j] = actuator(j).getStress(sj);
+    }
+}
+
 //_____________________________________________________________________________
 /**
  * Set whether or not a curvature filter should be applied to the controls.
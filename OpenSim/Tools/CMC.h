@@ -204,6 +204,23 @@ public:
     virtual void computeInitialStates(SimTK::State& s, double &rTI);
     /** CMC algorithm */
     virtual void computeControls(SimTK::State& s, ControlSet &rX);
+    /** Compute the task accelerations when the actuators apply no force,
+    `rA0`, and the matrix `rDADF` whose column j is the change in the task
+    accelerations per unit force of actuator j; the task accelerations are
+    in the order of CMC_TaskSet::getAccelerations(). `rUnitStress` holds the
+    stress of each actuator when it applies a unit force. The state `s` is
+    not modified.
+
+    The task accelerations are linear in the actuator forces, so the map is
+    exact. It is built from one realization of the model and one
+    factorization of the constrained equations of motion, solved with the
+    generalized force of each actuator as a right-hand side. If a
+    coordinate is prescribed or a task cannot compute its acceleration
+    sensitivity (see CMC_Task::computeAccelerationSensitivity()), the model
+    is instead realized with a unit force for each actuator in turn. */
+    void computeActuatorAccelerationMap(const SimTK::State& s,
+        SimTK::Vector& rA0, SimTK::Matrix& rDADF,
+        SimTK::Vector& rUnitStress) const;
 
     //--------------------------------------------------------------------------
     // STATIC
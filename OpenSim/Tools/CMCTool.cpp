@@ -392,11 +392,10 @@ bool CMCTool::run()
         throw(Exception(msg,__FILE__,__LINE__));
     }
     // OUTPUT DIRECTORY
-    // Do the maneuver to change then restore working directory 
+    // Resolve relative file names against the directory of the setup file
     // so that the parsing code behaves properly if called from a different directory
-    string saveWorkingDirectory = IO::getCwd();
-    string directoryOfSetupFile = IO::getParentDirectory(getDocumentFileName());
-    IO::chDir(directoryOfSetupFile);
+    ScopedBaseDirectory directoryOfSetupFile(
+            IO::getParentDirectory(getDocumentFileName()));
 
     try {
 
@@ -433,7 +432,6 @@ bool CMCTool::run()
     // DESIRED POINTS AND KINEMATICS
     if(_desiredPointsFileName=="" && _desiredKinematicsFileName=="") {
         cout<<"ERROR- a desired points file and desired kinematics file were not specified.\n\n";
-        IO::chDir(saveWorkingDirectory);
         return false;
     }
 
@@ -530,7 +528,6 @@ bool CMCTool::run()
      // TASK SET
     if(_taskSetFileName=="") {           
         cout<<"ERROR- a task set was not specified\n\n";         
-        IO::chDir(saveWorkingDirectory);         
         return false;        
     }
 
@@ -768,12 +765,10 @@ bool CMCTool::run()
         catch(const Exception& x) {
         // TODO: eventually might want to allow writing of partial results
             x.print(cout);
-            IO::chDir(saveWorkingDirectory);
             return false;
         }
         catch(...) {
             // TODO: eventually might want to allow writing of partial results
-            IO::chDir(saveWorkingDirectory);
             // close open files if we die prematurely (e.g. Opt fail)
             return false;
         }
@@ -831,14 +826,12 @@ bool CMCTool::run()
     catch(const Exception& x) {
         // TODO: eventually might want to allow writing of partial results
         x.print(cout);
-        IO::chDir(saveWorkingDirectory);
         // close open files if we die prematurely (e.g. Opt fail)
         manager.getStateStorage().print(getResultsDir() + "/" + getName() + "_states.sto");
         return false;
     }
     catch(...) {
         // TODO: eventually might want to allow writing of partial results
-        IO::chDir(saveWorkingDirectory);
         // close open files if we die prematurely (e.g. Opt fail)
         manager.getStateStorage().print(getResultsDir() + "/" + getName() + "_states.sto");
         return false;
@@ -876,14 +869,11 @@ bool CMCTool::run()
     } catch(const Exception& x) {
         // TODO: eventually might want to allow writing of partial results
         x.print(cout);
-        IO::chDir(saveWorkingDirectory);
         // close open files if we die prematurely (e.g. Opt fail)
         
         return false;
     }
 
-    IO::chDir(saveWorkingDirectory);
-
     return true;
 }
 
@@ -370,6 +370,24 @@ computeAccelerations(const SimTK::State& s )
     // ACCELERATION
     _a[0] = _q->getAccelerationValue(s);
 }
+//_____________________________________________________________________________
+/**
+ * Compute the change in the acceleration of the coordinate due to a change
+ * in the generalized accelerations, which is simply the element of dudot
+ * that corresponds to the coordinate.
+ */
+bool CMC_Joint::
+computeAccelerationSensitivity(const SimTK::State& s,
+        const SimTK::Vector& dudot, SimTK::Vec3& rDA) const
+{
+    if(_model==NULL || _q==NULL) return false;
+
+    const SimTK::MobilizedBody& mobod =
+        _model->getMatterSubsystem().getMobilizedBody(_q->getBodyIndex());
+    rDA = SimTK::NaN;
+    rDA[0] = dudot[int(mobod.getFirstUIndex(s)) + _q->getMobilizerQIndex()];
+    return true;
+}
 
 
 //=============================================================================
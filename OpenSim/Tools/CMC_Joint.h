@@ -103,6 +103,8 @@ public:
     void computeDesiredAccelerations(const SimTK::State& s, double aT) override;
     void computeDesiredAccelerations(const SimTK::State& s, double aTI,double aTF) override;
     void computeAccelerations(const SimTK::State& s ) override;
+    bool computeAccelerationSensitivity(const SimTK::State& s,
+            const SimTK::Vector& dudot, SimTK::Vec3& rDA) const override;
 
     //--------------------------------------------------------------------------
     // XML
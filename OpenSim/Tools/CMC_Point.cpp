@@ -457,6 +457,40 @@ computeAccelerations(const SimTK::State& s )
                                             + "' references invalid acceleration components",__FILE__,__LINE__);
     }
 }
+//_____________________________________________________________________________
+/**
+ * Compute the change in the acceleration of the point due to a change in
+ * the generalized accelerations. The point acceleration is J*udot plus
+ * terms that depend only on the velocities, so its change is J*dudot, where
+ * J is the station Jacobian of the point (or the mass-weighted average of
+ * the station Jacobians of the body mass centers for the center of mass).
+ */
+bool CMC_Point::
+computeAccelerationSensitivity(const SimTK::State& s,
+        const SimTK::Vector& dudot, SimTK::Vec3& rDA) const
+{
+    if(_model==NULL) return false;
+
+    const SimTK::SimbodyMatterSubsystem& matter = _model->getMatterSubsystem();
+    const BodySet& bs = _model->getBodySet();
+    if(_wrtBodyName == "center_of_mass") {
+        rDA = 0;
+        double mass = 0.0;
+        for(int i=0;i<bs.getSize();i++) {
+            const Body& body = bs.get(i);
+            rDA += body.get_mass() * matter.multiplyByStationJacobian(s,
+                    body.getMobilizedBodyIndex(), body.get_mass_center(), dudot);
+            mass += body.get_mass();
+        }
+        rDA /= mass;
+    } else {
+        if(!bs.contains(_wrtBodyName)) return false;
+        const Body& body = bs.get(_wrtBodyName);
+        rDA = matter.multiplyByStationJacobian(s, body.getMobilizedBodyIndex(),
+                _point, dudot);
+    }
+    return true;
+}
 
 //=============================================================================
 // XML
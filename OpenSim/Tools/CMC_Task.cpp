@@ -891,6 +891,24 @@ getAcceleration(int aWhich) const
 //=============================================================================
 // COMPUTATIONS
 //=============================================================================
+//-----------------------------------------------------------------------------
+// ACCELERATION SENSITIVITY
+//-----------------------------------------------------------------------------
+//_____________________________________________________________________________
+/**
+ * Compute the change in the task accelerations due to a change in the
+ * generalized accelerations. Tasks that do not override this method are
+ * handled by realizing the model to the acceleration stage instead.
+ *
+ * @return False, always.
+ */
+bool CMC_Task::
+computeAccelerationSensitivity(const SimTK::State& s,
+        const SimTK::Vector& dudot, SimTK::Vec3& rDA) const
+{
+    return false;
+}
+
 //-----------------------------------------------------------------------------
 // JACOBIAN
 //-----------------------------------------------------------------------------
@@ -212,6 +212,16 @@ public:
     virtual void computeDesiredAccelerations(const SimTK::State& s, double aT) = 0;
     virtual void computeDesiredAccelerations(const SimTK::State& s, double aTI,double aTF) = 0;
     virtual void computeAccelerations(const SimTK::State& s ) = 0;
+    /** Compute the change in the accelerations of the task goals (see
+    getAcceleration()) that results from a change `dudot` in the
+    generalized accelerations, at a state realized to at least
+    Stage::Position. Unlike computeAccelerations(), this does not require
+    the state to be realized to Stage::Acceleration, which lets CMC find
+    the effect of every actuator on the task accelerations from a single
+    solve of the equations of motion. Return false if the task cannot
+    compute this; the default implementation returns false. */
+    virtual bool computeAccelerationSensitivity(const SimTK::State& s,
+            const SimTK::Vector& dudot, SimTK::Vec3& rDA) const;
     virtual void computeJacobian();
     virtual void computeEffectiveMassMatrix();
 
@@ -265,14 +265,12 @@ bool DynamicsTool::createExternalLoads( const string& aExternalLoadsFileName,
         }
         else {
             // attempt to find the file local to the external loads XML file
-            std::string savedCwd = IO::getCwd();
-            IO::chDir(IO::getParentDirectory(aExternalLoadsFileName));
+            ScopedBaseDirectory directoryOfExternalLoads(
+                    IO::getParentDirectory(aExternalLoadsFileName));
             if (IO::FileExists(loadKinematicsFileName)) {
                 temp = new Storage(loadKinematicsFileName);
-                IO::chDir(savedCwd);
             }
             else {
-                IO::chDir(savedCwd);
                 throw Exception("DynamicsTool: could not find external loads kinematics file '"
                     + loadKinematicsFileName + "'.");
             }
@@ -240,11 +240,10 @@ bool ForwardTool::run()
     // SET OUTPUT PRECISION
     IO::SetPrecision(_outputPrecision);
 
-    // Do the maneuver to change then restore working directory 
+    // Resolve relative file names against the directory of the setup file
     // so that the parsing code behaves properly if called from a different directory.
-    string saveWorkingDirectory = IO::getCwd();
-    string directoryOfSetupFile = IO::getParentDirectory(getDocumentFileName());
-    IO::chDir(directoryOfSetupFile);
+    ScopedBaseDirectory directoryOfSetupFile(
+            IO::getParentDirectory(getDocumentFileName()));
 
     /*bool externalLoads = */createExternalLoads(_externalLoadsFileName, *_model);
 
@@ -310,18 +309,15 @@ bool ForwardTool::run()
         cout << "ForwardTool::run() caught exception \n";
         cout << x.what() << endl;
         completed = false;
-        IO::chDir(saveWorkingDirectory);
     }
     catch (...) { // e.g. may get InterruptedException
         printf("ForwardTool::run() caught exception \n"  );
         completed = false;
-        IO::chDir(saveWorkingDirectory);
     }
     // PRINT RESULTS
     string fileName;
     if(_printResultFiles) printResults();
 
-    IO::chDir(saveWorkingDirectory);
 
     removeAnalysisSetFromModel();
     return completed;
@@ -333,11 +329,10 @@ bool ForwardTool::run()
 //=============================================================================
 void ForwardTool::printResults() 
 {
-    // Do the maneuver to change then restore working directory 
+    // Resolve relative file names against the directory of the setup file
     // so that the parsing code behaves properly if called from a different directory.
-    string saveWorkingDirectory = IO::getCwd();
-    string directoryOfSetupFile = IO::getParentDirectory(getDocumentFileName());
-    IO::chDir(directoryOfSetupFile);
+    ScopedBaseDirectory directoryOfSetupFile(
+            IO::getParentDirectory(getDocumentFileName()));
 
     AbstractTool::printResults(getName(),getResultsDir()); // this will create results directory if necessary
     if(_model) {
@@ -352,7 +347,6 @@ void ForwardTool::printResults()
 
 
     
-    IO::chDir(saveWorkingDirectory);
 }
 
 
@@ -503,11 +497,9 @@ const Manager& ForwardTool::getManager() const {
 {
     int documentVersion = versionNumber;
     bool neededSprings=false;
-    std::string savedCwd;
-    if(getDocument()) {
-        savedCwd = IO::getCwd();
-        IO::chDir(IO::getParentDirectory(getDocument()->getFileName()));
-    }   
+    ScopedBaseDirectory directoryOfDocument(getDocument() ?
+            IO::getParentDirectory(getDocument()->getFileName()) :
+            std::string());
     if ( documentVersion < XMLDocument::getLatestVersion()){
             // Now check if we need to create a correction controller to replace springs
         if (documentVersion<10904){
@@ -538,6 +530,5 @@ const Manager& ForwardTool::getManager() const {
     }
     else
         AbstractTool::updateFromXMLNode(aNode, versionNumber);
-    if(getDocument()) IO::chDir(savedCwd);
     //Object::updateFromXMLNode(aNode, versionNumber);
 }
@@ -250,11 +250,10 @@ bool InverseDynamicsTool::run()
         _model->printBasicInfo();
 
         cout<<"Running tool " << getName() <<".\n"<<endl;
-        // Do the maneuver to change then restore working directory 
+        // Resolve relative file names against the directory of the setup file
         // so that the parsing code behaves properly if called from a different directory.
-        string saveWorkingDirectory = IO::getCwd();
-        string directoryOfSetupFile = IO::getParentDirectory(getDocumentFileName());
-        IO::chDir(directoryOfSetupFile);
+        ScopedBaseDirectory directoryOfSetupFile(
+                IO::getParentDirectory(getDocumentFileName()));
 
         /*bool externalLoads = */createExternalLoads(_externalLoadsFileName, *_model);
         // Initialize the model's underlying computational system and get its default state.
@@ -299,7 +298,6 @@ bool InverseDynamicsTool::run()
             }
         }
         else{
-            IO::chDir(saveWorkingDirectory);
             throw Exception("InverseDynamicsTool: no coordinate file found, "
                 " or setCoordinateValues() was not called.");
         }
@@ -408,7 +406,6 @@ bool InverseDynamicsTool::run()
 
         IO::makeDir(getResultsDir());
         Storage::printResult(&genForceResults, _outputGenForceFileName, getResultsDir(), -1, ".sto");
-        IO::chDir(saveWorkingDirectory);
 
         // if body forces to be reported for specified joints
         if(nj >0){
@@ -417,7 +414,6 @@ bool InverseDynamicsTool::run()
 
             IO::makeDir(getResultsDir());
             Storage::printResult(&bodyForcesResults, _outputBodyForcesAtJointsFileName, getResultsDir(), -1, ".sto");
-            IO::chDir(saveWorkingDirectory);
         }
 
         removeExternalLoadsFromModel();
@@ -40,6 +40,8 @@
 #include "IKCoordinateTask.h"
 #include "IKMarkerTask.h"
 
+#include <chrono>
+
 
 using namespace OpenSim;
 using namespace std;
@@ -137,6 +139,7 @@ void InverseKinematicsTool::setNull()
 {
     setupProperties();
     _model = NULL;
+    _frameLogInterval = 1.0;
 }
 //_____________________________________________________________________________
 /**
@@ -252,6 +255,7 @@ operator=(const InverseKinematicsTool &aTool)
     _reportErrors = aTool._reportErrors;
     _outputMotionFileName = aTool._outputMotionFileName;
     _reportMarkerLocations = aTool._reportMarkerLocations;
+    _frameLogInterval = aTool._frameLogInterval;
 
     return(*this);
 }
@@ -288,11 +292,11 @@ bool InverseKinematicsTool::run()
         _model->finalizeFromProperties();
         _model->printBasicInfo();
 
-        // Do the maneuver to change then restore working directory so that the
-        // parsing code behaves properly if called from a different directory.
-        string saveWorkingDirectory = IO::getCwd();
-        string directoryOfSetupFile = IO::getParentDirectory(getDocumentFileName());
-        IO::chDir(directoryOfSetupFile);
+        // Resolve relative file names against the directory of the setup file
+        // so that the parsing code behaves properly if called from a different
+        // directory.
+        ScopedBaseDirectory directoryOfSetupFile(
+                IO::getParentDirectory(getDocumentFileName()));
 
         // Define reporter for output
         kinematicsReporter = new Kinematics();
@@ -352,6 +356,9 @@ bool InverseKinematicsTool::run()
         int nm = ikSolver.getNumMarkersInUse();
         SimTK::Array_<double> squaredMarkerErrors(nm, 0.0);
         SimTK::Array_<Vec3> markerLocations(nm, Vec3(0));
+        // Rows of the error and location files, reused for every frame.
+        double markerErrors[3];
+        std::vector<double> locations(3*nm);
         
         Storage *modelMarkerLocations = _reportMarkerLocations ?
             new Storage(Nframes, "ModelMarkerLocations") : nullptr;
@@ -359,18 +366,24 @@ bool InverseKinematicsTool::run()
             new Storage(Nframes, "ModelMarkerErrors") : nullptr;
 
         const clock_t start = clock();
+        // The frame log is throttled by wall-clock time.
+        using Clock = std::chrono::steady_clock;
+        Clock::time_point lastLog = Clock::now();
 
         for (int i = start_ix; i <= final_ix; ++i) {
             s.updTime() = times[i];
             ikSolver.track(s);
+
+            // Evaluate each marker location once for both reports.
+            if (_reportErrors || _reportMarkerLocations)
+                ikSolver.computeCurrentMarkerLocationsAndSquaredErrors(
+                        markerLocations, squaredMarkerErrors);
             
             if(_reportErrors){
-                Array<double> markerErrors(0.0, 3);
                 double totalSquaredMarkerError = 0.0;
                 double maxSquaredMarkerError = 0.0;
                 int worst = -1;
 
-                ikSolver.computeCurrentSquaredMarkerErrors(squaredMarkerErrors);
                 for(int j=0; j<nm; ++j){
                     totalSquaredMarkerError += squaredMarkerErrors[j];
                     if(squaredMarkerErrors[j] > maxSquaredMarkerError){
@@ -380,27 +393,33 @@ bool InverseKinematicsTool::run()
                 }
 
                 double rms = nm > 0 ? sqrt(totalSquaredMarkerError / nm) : 0;
-                markerErrors.set(0, totalSquaredMarkerError); 
-                markerErrors.set(1, rms);
-                markerErrors.set(2, sqrt(maxSquaredMarkerError));
-                modelMarkerErrors->append(s.getTime(), 3, &markerErrors[0]);
-
-                cout << "Frame " << i << " (t=" << s.getTime() << "):\t"
-                    << "total squared error = " << totalSquaredMarkerError
-                    << ", marker error: RMS=" << rms << ", max="
-                    << sqrt(maxSquaredMarkerError) << " (" 
-                    << ikSolver.getMarkerNameForIndex(worst) << ")" << endl;
+                markerErrors[0] = totalSquaredMarkerError;
+                markerErrors[1] = rms;
+                markerErrors[2] = sqrt(maxSquaredMarkerError);
+                modelMarkerErrors->append(s.getTime(), 3, markerErrors);
+
+                const Clock::time_point now = Clock::now();
+                if (_frameLogInterval >= 0 && (i == final_ix ||
+                        std::chrono::duration<double>(now - lastLog).count()
+                            >= _frameLogInterval)) {
+                    lastLog = now;
+                    cout << "Frame " << i << " (t=" << s.getTime() << "):\t"
+                        << "total squared error = " << totalSquaredMarkerError
+                        << ", marker error: RMS=" << rms << ", max="
+                        << sqrt(maxSquaredMarkerError) << " ("
+                        << (worst >= 0 ? ikSolver.getMarkerNameForIndex(worst)
+                                       : "") << ")" << endl;
+                }
             }
 
             if(_reportMarkerLocations){
-                ikSolver.computeCurrentMarkerLocations(markerLocations);
-                Array<double> locations(0.0, 3*nm);
                 for(int j=0; j<nm; ++j){
                     for(int k=0; k<3; ++k)
-                        locations.set(3*j+k, markerLocations[j][k]);
+                        locations[3*j+k] = markerLocations[j][k];
                 }
 
-                modelMarkerLocations->append(s.getTime(), 3*nm, &locations[0]);
+                modelMarkerLocations->append(s.getTime(), 3*nm,
+                                             locations.data());
 
             }
 
@@ -408,7 +427,7 @@ bool InverseKinematicsTool::run()
             analysisSet.step(s, i);
         }
 
-        // Do the maneuver to change then restore working directory 
+        // Resolve relative file names against the directory of the setup file
         // so that output files are saved to same folder as setup file.
         if (_outputMotionFileName!= "" && _outputMotionFileName!="Unassigned"){
             kinematicsReporter->getPositionStorage()->print(_outputMotionFileName);
@@ -455,8 +474,6 @@ bool InverseKinematicsTool::run()
             delete modelMarkerLocations;
         }
 
-        IO::chDir(saveWorkingDirectory);
-
         success = true;
 
         cout << "InverseKinematicsTool completed " << Nframes << " frames in "
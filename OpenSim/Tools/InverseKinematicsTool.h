@@ -107,6 +107,9 @@ private:
     PropertyBool _reportMarkerLocationsProp;
     bool &_reportMarkerLocations;
 
+    // minimum wall-clock time in seconds between per-frame error summaries
+    double _frameLogInterval;
+
 //=============================================================================
 // METHODS
 //=============================================================================
@@ -159,6 +162,12 @@ public:
         _outputMotionFileName = aOutputMotionFileName;
     }
     std::string getOutputMotionFileName() { return _outputMotionFileName;}
+    /** When marker errors are reported, run() prints a summary of the errors
+    of a frame at most once every `seconds` of wall-clock time, and for the
+    last frame. Use 0 to print every frame and a negative value to print
+    none. The default is 1 second. The error file contains all frames. */
+    void setFrameLogInterval(double seconds) { _frameLogInterval = seconds; }
+    double getFrameLogInterval() const { return _frameLogInterval; }
     IKTaskSet& getIKTaskSet() { return _ikTaskSet; }
 
     //--------------------------------------------------------------------------
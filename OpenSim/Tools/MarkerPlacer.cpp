@@ -388,8 +388,7 @@ bool MarkerPlacer::processModel(Model* aModel,
     _outputStorage->getStateVector(0)->setTime(s.getTime());
 
     if(_printResultFiles) {
-        std::string savedCwd = IO::getCwd();
-        IO::chDir(aPathToSubject);
+        ScopedBaseDirectory directoryOfSubject(aPathToSubject);
 
         try { // writing can throw an exception
             if (_outputModelFileNameProp.isValidFileName()) {
@@ -409,12 +408,10 @@ bool MarkerPlacer::processModel(Model* aModel,
                     "w", "File generated from solving marker data for model "
                     + aModel->getName());
             }
-        } // catch the exception so we can reset the working directory
+        }
         catch (std::exception& ex) {
-            IO::chDir(savedCwd);
             OPENSIM_THROW_FRMOBJ(Exception, ex.what());
         }
-        IO::chDir(savedCwd);
     }
 
     return true;
@@ -267,6 +267,7 @@ bool ModelScaler::processModel(Model* aModel, const string& aPathToSubject,
                 }
 
                 /* Now take and apply the measurements. */
+                std::vector<double> scaleFactors;
                 for (int j = 0; j < _measurementSet.getSize(); j++)
                 {
                     if (_measurementSet.get(j).getApply())
@@ -274,7 +275,9 @@ bool ModelScaler::processModel(Model* aModel, const string& aPathToSubject,
                         if(!markerData)
                             throw Exception("ModelScaler.processModel: ERROR- "+_markerFileNameProp.getName()+
                                                 " not set but measurements are used",__FILE__,__LINE__);
-                        double scaleFactor = computeMeasurementScaleFactor(s,*aModel, *markerData, _measurementSet.get(j));
+                        if (scaleFactors.empty())
+                            scaleFactors = computeMeasurementScaleFactors(s, *aModel, *markerData);
+                        double scaleFactor = scaleFactors[j];
                         if (!SimTK::isNaN(scaleFactor))
                             _measurementSet.get(j).applyScaleFactor(scaleFactor, theScaleSet);
                         else
@@ -312,8 +315,7 @@ bool ModelScaler::processModel(Model* aModel, const string& aPathToSubject,
         aModel->scale(s, theScaleSet, _preserveMassDist, aSubjectMass);
 
         if(_printResultFiles) {
-            std::string savedCwd = IO::getCwd();
-            IO::chDir(aPathToSubject);
+            ScopedBaseDirectory directoryOfSubject(aPathToSubject);
             try { // writing can throw an exception
                 if (_outputModelFileNameProp.isValidFileName()) {
                     if (aModel->print(_outputModelFileName))
@@ -326,12 +328,10 @@ bool ModelScaler::processModel(Model* aModel, const string& aPathToSubject,
                         cout << "Wrote scale file " << _outputScaleFileName <<
                         " for model " << aModel->getName() << endl;
                 }
-            } // catch the exception so we can reset the working directory
+            }
             catch (std::exception& ex) {
-                IO::chDir(savedCwd);
                 OPENSIM_THROW_FRMOBJ(Exception, ex.what());
             }
-            IO::chDir(savedCwd);
         }
     }
     catch (const Exception& x) {
@@ -349,6 +349,66 @@ bool ModelScaler::processModel(Model* aModel, const string& aPathToSubject,
  * in the experimental marker data by the distance between the pair on the model.
  */
 double ModelScaler::computeMeasurementScaleFactor(const SimTK::State& s, const Model& aModel, const MarkerData& aMarkerData, const Measurement& aMeasurement) const
+{
+    std::vector<std::pair<int, int>> markerPairs;
+    for(int i=0; i<aMeasurement.getNumMarkerPairs(); i++) {
+        string name1, name2;
+        aMeasurement.getMarkerPair(i).getMarkerNames(name1, name2);
+        markerPairs.push_back({findExperimentalMarker(aMarkerData, name1, aMeasurement.getName()),
+                               findExperimentalMarker(aMarkerData, name2, aMeasurement.getName())});
+    }
+    return computeMeasurementScaleFactor(s, aModel, aMeasurement,
+            takeExperimentalMarkerMeasurements(aMarkerData, markerPairs));
+}
+
+//_____________________________________________________________________________
+/**
+ * Compute the scale factors of all the measurements at once. The marker
+ * pairs of the applied measurements are gathered first so that the
+ * experimental marker data is traversed only once, rather than once per
+ * marker pair.
+ */
+std::vector<double> ModelScaler::computeMeasurementScaleFactors(const SimTK::State& s, const Model& aModel, const MarkerData& aMarkerData) const
+{
+    const int numMeasurements = _measurementSet.getSize();
+
+    // Offset of each measurement's first marker pair in markerPairs.
+    std::vector<int> firstPair(numMeasurements + 1, 0);
+    std::vector<std::pair<int, int>> markerPairs;
+    for (int j = 0; j < numMeasurements; j++) {
+        firstPair[j] = (int)markerPairs.size();
+        const Measurement& measurement = _measurementSet.get(j);
+        if (!measurement.getApply()) continue;
+        for (int i = 0; i < measurement.getNumMarkerPairs(); i++) {
+            string name1, name2;
+            measurement.getMarkerPair(i).getMarkerNames(name1, name2);
+            markerPairs.push_back({findExperimentalMarker(aMarkerData, name1, measurement.getName()),
+                                   findExperimentalMarker(aMarkerData, name2, measurement.getName())});
+        }
+    }
+    firstPair[numMeasurements] = (int)markerPairs.size();
+
+    const std::vector<double> lengths =
+            takeExperimentalMarkerMeasurements(aMarkerData, markerPairs);
+
+    std::vector<double> scaleFactors(numMeasurements, SimTK::NaN);
+    for (int j = 0; j < numMeasurements; j++) {
+        const Measurement& measurement = _measurementSet.get(j);
+        if (!measurement.getApply()) continue;
+        std::vector<double> measurementLengths(lengths.begin() + firstPair[j],
+                                               lengths.begin() + firstPair[j + 1]);
+        scaleFactors[j] = computeMeasurementScaleFactor(s, aModel, measurement,
+                                                        measurementLengths);
+    }
+    return scaleFactors;
+}
+
+//_____________________________________________________________________________
+/**
+ * Compute the scale factor of a measurement given the average experimental
+ * length of each of its marker pairs.
+ */
+double ModelScaler::computeMeasurementScaleFactor(const SimTK::State& s, const Model& aModel, const Measurement& aMeasurement, const std::vector<double>& aExperimentalLengths) const
 {
     double scaleFactor = 0;
     cout << "Measurement '" << aMeasurement.getName() << "'" << endl;
@@ -358,7 +418,7 @@ double ModelScaler::computeMeasurementScaleFactor(const SimTK::State& s, const M
         string name1, name2;
         pair.getMarkerNames(name1, name2);
         double modelLength = takeModelMeasurement(s, aModel, name1, name2, aMeasurement.getName());
-        double experimentalLength = takeExperimentalMarkerMeasurement(aMarkerData, name1, name2, aMeasurement.getName());
+        double experimentalLength = aExperimentalLengths[i];
         if(SimTK::isNaN(modelLength) || SimTK::isNaN(experimentalLength)) return SimTK::NaN;
         cout << "\tpair " << i << " (" << name1 << ", " << name2 << "): model = " << modelLength << ", experimental = " << experimentalLength << endl;
         scaleFactor += experimentalLength / modelLength;
@@ -396,27 +456,59 @@ double ModelScaler::takeModelMeasurement(const SimTK::State& s, const Model& aMo
  */
 double ModelScaler::takeExperimentalMarkerMeasurement(const MarkerData& aMarkerData, const string& aName1, const string& aName2, const string& aMeasurementName) const
 {
-    const Array<string>& experimentalMarkerNames = aMarkerData.getMarkerNames();
-    int marker1 = experimentalMarkerNames.findIndex(aName1);
-    int marker2 = experimentalMarkerNames.findIndex(aName2);
-    if (marker1 >= 0 && marker2 >= 0) {
-        int startIndex, endIndex;
-        if (_timeRange.getSize()<2) 
-            throw Exception("ModelScaler::takeExperimentalMarkerMeasurement, time_range is unspecified.");
-
-        aMarkerData.findFrameRange(_timeRange[0], _timeRange[1], startIndex, endIndex);
-        double length = 0;
-        for(int i=startIndex; i<=endIndex; i++) {
-            Vec3 p1 = aMarkerData.getFrame(i).getMarker(marker1);
-            Vec3 p2 = aMarkerData.getFrame(i).getMarker(marker2);
-            length += (p2 - p1).norm();
+    const std::vector<std::pair<int, int>> markerPairs{
+            {findExperimentalMarker(aMarkerData, aName1, aMeasurementName),
+             findExperimentalMarker(aMarkerData, aName2, aMeasurementName)}};
+    return takeExperimentalMarkerMeasurements(aMarkerData, markerPairs)[0];
+}
+
+//_____________________________________________________________________________
+/**
+ * Find the index of a marker in an experimental marker data.
+ *
+ * @return The index of the marker, or -1 (with a warning) if it is missing.
+ */
+int ModelScaler::findExperimentalMarker(const MarkerData& aMarkerData, const string& aName, const string& aMeasurementName) const
+{
+    int index = aMarkerData.getMarkerNames().findIndex(aName);
+    if (index < 0)
+        cout << "___WARNING___: marker " << aName << " in " << aMeasurementName << " measurement not found in " << aMarkerData.getFileName() << endl;
+    return index;
+}
+
+//_____________________________________________________________________________
+/**
+ * Measure the average distance between each of the given pairs of markers
+ * (specified by their indices in the marker data) over the time range, in a
+ * single pass over the frames. Pairs with a missing marker (index < 0) have
+ * a length of NaN.
+ */
+std::vector<double> ModelScaler::takeExperimentalMarkerMeasurements(const MarkerData& aMarkerData, const std::vector<std::pair<int, int>>& aMarkerPairs) const
+{
+    std::vector<double> lengths(aMarkerPairs.size(), 0.0);
+    if (aMarkerPairs.empty()) return lengths;
+
+    if (_timeRange.getSize()<2) 
+        throw Exception("ModelScaler::takeExperimentalMarkerMeasurements, time_range is unspecified.");
+
+    int startIndex, endIndex;
+    aMarkerData.findFrameRange(_timeRange[0], _timeRange[1], startIndex, endIndex);
+    for(int i=startIndex; i<=endIndex; i++) {
+        const SimTK::Array_<Vec3>& markers = aMarkerData.getFrame(i).getMarkers();
+        for (size_t k = 0; k < aMarkerPairs.size(); k++) {
+            const int marker1 = aMarkerPairs[k].first;
+            const int marker2 = aMarkerPairs[k].second;
+            if (marker1 >= 0 && marker2 >= 0)
+                lengths[k] += (markers[marker2] - markers[marker1]).norm();
         }
-        return length/(endIndex-startIndex+1);
-    } else {
-        if (marker1 < 0)
-            cout << "___WARNING___: marker " << aName1 << " in " << aMeasurementName << " measurement not found in " << aMarkerData.getFileName() << endl;
-        if (marker2 < 0)
-            cout << "___WARNING___: marker " << aName2 << " in " << aMeasurementName << " measurement not found in " << aMarkerData.getFileName() << endl;
-        return SimTK::NaN;
     }
+
+    const int numFrames = endIndex - startIndex + 1;
+    for (size_t k = 0; k < aMarkerPairs.size(); k++) {
+        if (aMarkerPairs[k].first >= 0 && aMarkerPairs[k].second >= 0)
+            lengths[k] /= numFrames;
+        else
+            lengths[k] = SimTK::NaN;
+    }
+    return lengths;
 }
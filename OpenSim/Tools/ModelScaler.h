@@ -189,11 +189,22 @@ public:
     void setPrintResultFiles(bool aToWrite) { _printResultFiles = aToWrite; }
 
     double computeMeasurementScaleFactor(const SimTK::State& s, const Model& aModel, const MarkerData& aMarkerData, const Measurement& aMeasurement) const;
+    /**
+     * Compute the scale factor of every measurement in the MeasurementSet.
+     * The experimental distances of all marker pairs used by the applied
+     * measurements are computed in a single pass over the frames of the
+     * marker data. Entries for measurements that are not applied, or that
+     * cannot be evaluated, are NaN.
+     */
+    std::vector<double> computeMeasurementScaleFactors(const SimTK::State& s, const Model& aModel, const MarkerData& aMarkerData) const;
 private:
     void setNull();
     void setupProperties();
     double takeModelMeasurement(const SimTK::State& s, const Model& aModel, const std::string& aName1, const std::string& aName2, const std::string& aMeasurementName) const;
     double takeExperimentalMarkerMeasurement(const MarkerData& aMarkerData, const std::string& aName1, const std::string& aName2, const std::string& aMeasurementName) const;
+    int findExperimentalMarker(const MarkerData& aMarkerData, const std::string& aName, const std::string& aMeasurementName) const;
+    std::vector<double> takeExperimentalMarkerMeasurements(const MarkerData& aMarkerData, const std::vector<std::pair<int, int>>& aMarkerPairs) const;
+    double computeMeasurementScaleFactor(const SimTK::State& s, const Model& aModel, const Measurement& aMeasurement, const std::vector<double>& aExperimentalLengths) const;
 
 //=============================================================================
 };  // END of class ModelScaler
@@ -353,11 +353,10 @@ bool RRATool::run()
         throw(Exception(msg,__FILE__,__LINE__));
     }
     // OUTPUT DIRECTORY
-    // Do the maneuver to change then restore working directory 
+    // Resolve relative file names against the directory of the setup file
     // so that the parsing code behaves properly if called from a different directory
-    string saveWorkingDirectory = IO::getCwd();
-    string directoryOfSetupFile = IO::getParentDirectory(getDocumentFileName());
-    IO::chDir(directoryOfSetupFile);
+    ScopedBaseDirectory directoryOfSetupFile(
+            IO::getParentDirectory(getDocumentFileName()));
 
     try {
 
@@ -399,7 +398,6 @@ bool RRATool::run()
     // DESIRED POINTS AND KINEMATICS
     if(_desiredPointsFileName=="" && _desiredKinematicsFileName=="") {
         cout<<"ERROR- a desired points file and desired kinematics file were not specified.\n\n";
-        IO::chDir(saveWorkingDirectory);
         return false;
     }
 
@@ -496,7 +494,6 @@ bool RRATool::run()
      // TASK SET
     if(_taskSetFileName=="") {           
         cout<<"ERROR- a task set was not specified\n\n";         
-        IO::chDir(saveWorkingDirectory);         
         return false;        
     }
 
@@ -532,7 +529,6 @@ bool RRATool::run()
                 delete qStore;
                 delete uStore;
                 writeAdjustedModel();
-                IO::chDir(saveWorkingDirectory);
                 return true;
             }
         }
@@ -754,12 +750,10 @@ bool RRATool::run()
         catch(const Exception& x) {
         // TODO: eventually might want to allow writing of partial results
             x.print(cout);
-            IO::chDir(saveWorkingDirectory);
             return false;
         }
         catch(...) {
             // TODO: eventually might want to allow writing of partial results
-            IO::chDir(saveWorkingDirectory);
             // close open files if we die prematurely (e.g. Opt fail)
             return false;
         }
@@ -817,14 +811,12 @@ bool RRATool::run()
     catch(const Exception& x) {
         // TODO: eventually might want to allow writing of partial results
         x.print(cout);
-        IO::chDir(saveWorkingDirectory);
         // close open files if we die prematurely (e.g. Opt fail)
         manager.getStateStorage().print(getResultsDir() + "/" + getName() + "_states.sto");
         return false;
     }
     catch(...) {
         // TODO: eventually might want to allow writing of partial results
-        IO::chDir(saveWorkingDirectory);
         // close open files if we die prematurely (e.g. Opt fail)
         manager.getStateStorage().print(getResultsDir() + "/" + getName() + "_states.sto");
         return false;
@@ -873,7 +865,8 @@ bool RRATool::run()
         adjQMsg << "************************************************************\n" << endl;
 
         // Write the average residuals (DC offsets) out to a file
-        ofstream residualFile((getResultsDir() + "/" + getName() + "_avgResiduals.txt").c_str());
+        ofstream residualFile(IO::resolvePath(
+                getResultsDir() + "/" + getName() + "_avgResiduals.txt"));
         residualFile << "Average Residuals:\n\n";
         residualFile << "FX average = " << FAve[0] << "\n";
         residualFile << "FY average = " << FAve[1] << "\n";
@@ -894,13 +887,11 @@ bool RRATool::run()
     } catch(const Exception& x) {
         // TODO: eventually might want to allow writing of partial results
         x.print(cout);
-        IO::chDir(saveWorkingDirectory);
         // close open files if we die prematurely (e.g. Opt fail)
         
         return false;
     }
 
-    IO::chDir(saveWorkingDirectory);
 
     return true;
 }
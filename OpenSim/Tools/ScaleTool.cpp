@@ -29,6 +29,10 @@
 #include <OpenSim/Simulation/Model/Model.h>
 #include "GenericModelMaker.h"
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
 //=============================================================================
 // STATICS
 //=============================================================================
@@ -133,6 +137,7 @@ void ScaleTool::copyData(const ScaleTool &aSubject)
     _genericModelMaker = aSubject._genericModelMaker;
     _modelScaler = aSubject._modelScaler;
     _markerPlacer = aSubject._markerPlacer;
+    _pathToSubject = aSubject._pathToSubject;
 }
 
 //_____________________________________________________________________________
@@ -252,10 +257,18 @@ bool ScaleTool::run() const {
         throw Exception("scale: ERROR- No model specified.",__FILE__,__LINE__);
     }
 
+    return processModel(model.get());
+}
+
+//_____________________________________________________________________________
+/**
+ * Scale a model that has already been created and place markers on it.
+ */
+bool ScaleTool::processModel(Model* aModel) const {
     if (!isDefaultModelScaler() && getModelScaler().getApply())
     {
         const ModelScaler& scaler = getModelScaler();
-        if(!scaler.processModel(model.get(), getPathToSubject(), getSubjectMass())) {
+        if(!scaler.processModel(aModel, getPathToSubject(), getSubjectMass())) {
             return false;
         }
     }
@@ -267,7 +280,7 @@ bool ScaleTool::run() const {
     if (!isDefaultMarkerPlacer())
     {
         const MarkerPlacer& placer = getMarkerPlacer();
-        if(!placer.processModel(model.get(), getPathToSubject())) {
+        if(!placer.processModel(aModel, getPathToSubject())) {
             return false;
         }
     }
@@ -277,3 +290,60 @@ bool ScaleTool::run() const {
     }
     return true;
 }
+
+//_____________________________________________________________________________
+/**
+ * Scale many subjects concurrently from a single generic model. Subjects are
+ * handed out to the threads one at a time, so that a slow subject does not
+ * hold up the others.
+ */
+std::vector<std::unique_ptr<Model>> ScaleTool::runBatch(
+        const Model& genericModel,
+        const std::vector<ScaleTool>& subjects,
+        int numThreads) {
+    const int numSubjects = (int)subjects.size();
+    if (numThreads <= 0)
+        numThreads = std::max(1, (int)std::thread::hardware_concurrency());
+    numThreads = std::min(numThreads, numSubjects);
+
+    // Prepare each subject's tool and model copy up front, so the threads
+    // share nothing but read-only access to the subjects' data files.
+    // The base directory (IO::getBaseDirectory()) is per thread, so the
+    // subjects' paths are made absolute before the threads start; each
+    // subject then prints its results under its own directory.
+    const std::string cwd = IO::getCwd();
+    std::vector<ScaleTool> tools(subjects);
+    std::vector<std::unique_ptr<Model>> models(numSubjects);
+    for (int i = 0; i < numSubjects; ++i) {
+        ScaleTool& tool = tools[i];
+        const std::string path = IO::resolvePath(tool.getPathToSubject());
+        if (!IO::isAbsolutePath(path))
+            tool.setPathToSubject(cwd + "/" + path);
+        else
+            tool.setPathToSubject(path);
+
+        models[i].reset(genericModel.clone());
+        models[i]->setName(tool.getName());
+    }
+
+    std::atomic<int> next{0};
+    auto worker = [&]() {
+        for (int i = next++; i < numSubjects; i = next++) {
+            bool success = false;
+            try {
+                success = tools[i].processModel(models[i].get());
+            } catch (const std::exception& x) {
+                cout << "ScaleTool::runBatch: ERROR- subject "
+                     << tools[i].getName() << ": " << x.what() << endl;
+            }
+            if (!success) models[i].reset();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int t = 1; t < numThreads; ++t) threads.emplace_back(worker);
+    worker();
+    for (auto& thread : threads) thread.join();
+
+    return models;
+}
@@ -115,6 +115,31 @@ public:
      * @returns whether or not the scale procedure was successful. */
     bool run() const;
 
+    /** Run the ModelScaler and then the MarkerPlacer on a model that has
+     * already been created (e.g., a copy of a generic model held in memory),
+     * rather than on the model specified by the GenericModelMaker.
+     * @returns whether or not the scale procedure was successful. */
+    bool processModel(Model* aModel) const;
+
+#ifndef SWIG
+    /** Scale many subjects from a single generic model held in memory. Each
+     * subject's ModelScaler and MarkerPlacer are applied to its own copy of
+     * `genericModel` (the subjects' GenericModelMaker settings are ignored),
+     * and the subjects are processed concurrently on up to `numThreads`
+     * threads (0 uses the number of hardware threads). Relative paths to the
+     * subjects are resolved against the current working directory before
+     * any thread starts. Each subject writes its result files as run()
+     * does, relative to its own directory (see ScopedBaseDirectory), so
+     * subjects that share a directory should name their output files
+     * differently.
+     * @returns the scaled models, in the order of `subjects`, with nullptr
+     * for each subject that could not be scaled. */
+    static std::vector<std::unique_ptr<Model>> runBatch(
+            const Model& genericModel,
+            const std::vector<ScaleTool>& subjects,
+            int numThreads = 0);
+#endif
+
     bool isDefaultGenericModelMaker() const
     { return _genericModelMakerProp.getValueIsDefault(); }
     bool isDefaultModelScaler() const
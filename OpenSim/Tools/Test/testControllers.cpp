@@ -30,6 +30,7 @@
 //  2. Test a PrescribedController on a block with an ideal actuator
 //  3. Test a CorrectionController tracking a block with an ideal actuator
 //  4. Test a PrescribedController on the arm26 model with reserves.
+//  5. Test that ControlLinear finds the right nodes in any order of times.
 //     Add tests here as new controller types are added to OpenSim
 //
 //=============================================================================
@@ -46,6 +47,7 @@ void testCorrectionControllerOnBlock();
 void testPrescribedControllerFromFile(const std::string& modelFile,
                                       const std::string& actuatorsFile,
                                       const std::string& controlsFile);
+void testControlLinearNodeLookup();
 
 int main()
 {
@@ -60,6 +62,8 @@ int main()
         cout << "Testing PrescribedController from File" << endl;
         testPrescribedControllerFromFile("arm26.osim", "arm26_Reserve_Actuators.xml",
                                          "arm26_controls.xml");
+        cout << "Testing ControlLinear node lookup" << endl;
+        testControlLinearNodeLookup();
     }   
     catch (const std::exception& e) {
         cout << "TestControllers failed due to the following error(s):" << endl;
@@ -414,3 +418,49 @@ void testPrescribedControllerFromFile(const std::string& modelFile,
      
     osimModel.disownAllComponents();
 }
+
+//==========================================================================================================
+void testControlLinearNodeLookup()
+{
+    // Unevenly spaced nodes.
+    const int n = 25;
+    std::vector<double> times(n), values(n);
+    ControlLinear linear, steps;
+    linear.setExtrapolate(false);
+    steps.setUseSteps(true);
+    for (int i = 0; i < n; ++i) {
+        times[i] = 0.1 * i + 0.03 * (i % 2);
+        values[i] = 1.0 + i * i;
+        linear.setControlValue(times[i], values[i]);
+        steps.setControlValue(times[i], values[i]);
+    }
+
+    // Node i such that times[i] <= t < times[i+1].
+    auto expected = [&](double t, bool useSteps) {
+        if (t <= times[0]) return values[0];
+        if (t >= times[n-1]) return values[n-1];
+        int i = int(std::upper_bound(times.begin(), times.end(), t) -
+                    times.begin()) - 1;
+        if (useSteps)
+            return t == times[i] ? values[i] : values[i+1];
+        return values[i] + (t - times[i]) *
+                (values[i+1] - values[i]) / (times[i+1] - times[i]);
+    };
+
+    // Forward, backward, on the nodes, out of range and at random.
+    std::vector<double> queries;
+    for (double t = -0.2; t < 2.8; t += 0.011) queries.push_back(t);
+    for (double t = 2.8; t > -0.2; t -= 0.023) queries.push_back(t);
+    queries.insert(queries.end(), times.begin(), times.end());
+    SimTK::Random::Uniform random(-0.2, 2.8);
+    for (int i = 0; i < 200; ++i) queries.push_back(random.getValue());
+
+    for (double t : queries) {
+        ASSERT_EQUAL(expected(t, false), linear.getControlValue(t), 1e-12,
+                __FILE__, __LINE__, "ControlLinear interpolated at t = " +
+                std::to_string(t) + " is incorrect.");
+        ASSERT_EQUAL(expected(t, true), steps.getControlValue(t), 1e-12,
+                __FILE__, __LINE__, "ControlLinear step at t = " +
+                std::to_string(t) + " is incorrect.");
+    }
+}